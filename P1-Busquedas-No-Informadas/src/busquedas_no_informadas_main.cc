@@ -15,15 +15,64 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
 #include "funciones_cliente.h"
 #include "grafo.h"
 
 int main(int argc, char* argv[]) {
+  // Modo conversión a instantánea binaria
+  if (argc == 4 && std::string{argv[1]} == "--convertir") {
+    return ConvertirAInstantanea(argv[2], argv[3]);
+  }
+  // Modo benchmark del BFS paralelo
+  if ((argc == 3 || argc == 4) && std::string{argv[1]} == "--benchmark-bfs") {
+    unsigned hilos = std::thread::hardware_concurrency();
+    if (argc == 4 && !LeerNumeroHilos(argv[3], hilos)) {
+      return 1;
+    }
+    return BenchmarkBFSParalelo(argv[2], std::max(1u, hilos));
+  }
+  // Modo tabla de caminos mínimos entre todos los pares
+  if ((argc == 4 || argc == 5) && std::string{argv[1]} == "--tabla-caminos") {
+    unsigned hilos = 0;
+    if (argc == 5 && !LeerNumeroHilos(argv[4], hilos)) {
+      return 1;
+    }
+    return GenerarTablaCaminos(argv[2], argv[3], hilos);
+  }
+  if (argc == 5 && std::string{argv[1]} == "--consultar-tabla") {
+    return ConsultarTablaCaminos(argv[2], argv[3], argv[4]);
+  }
+  // En el modo por lotes solo se cuentan las iteraciones salvo que se pida otra traza
+  const bool modo_lote = argc >= 2 && std::string{argv[1]} == "--lote";
+  NivelTraza nivel_traza{modo_lote ? NivelTraza::kResumen : NivelTraza::kIteracion};
+  if (!ExtraerNivelTraza(argc, argv, nivel_traza)) {
+    return 1;
+  }
+  // Modo por lotes: muchas consultas sobre el mismo grafo
+  if (modo_lote && (argc == 5 || argc == 6)) {
+    unsigned hilos = 0;
+    if (argc == 6 && !LeerNumeroHilos(argv[5], hilos)) {
+      return 1;
+    }
+    return EjecutarLote(argv[2], argv[3], argv[4], hilos, nivel_traza);
+  }
   if (!CheckCorrectsParameters(argc, argv)) {
     return 1;
   }
   // 1. Cargar grafo
-  Grafo grafo(argv[1]);
+  Grafo grafo;
+  grafo.set_nivel_traza(nivel_traza);
+  try {
+    grafo.ProcesarGrafo(argv[1]);
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  std::cout << "Grafo cargado en " << grafo.tiempo_carga_ms() << " ms (" << grafo.numero_nodos() 
+            << " nodos, " << grafo.numero_aristas() << " aristas)\n";
   // 2. Obtener parámetros de búsqueda
   int origen, destino;
   std::cout << "Ingrese vértice origen (1-" << grafo.numero_nodos() << "): ";
@@ -0,0 +1,62 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 1: Busquedas no informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date Sep 01 2025
+  * @brief Definicion de los metodos de la clase FicheroMapeado
+  * @version 1.0
+  */
+
+#include "fichero_mapeado.h"
+#include <stdexcept>
+#include <string>
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+
+/**
+ * @brief Abre un fichero y lo proyecta en memoria de solo lectura
+ *
+ * @param nombre Ruta del fichero
+ * @throw std::runtime_error Si el fichero no se puede abrir o proyectar
+ *
+ * Un fichero vacío no se proyecta: queda con data() == nullptr y size() == 0.
+ */
+FicheroMapeado::FicheroMapeado(const std::string& nombre) {
+  const int descriptor = ::open(nombre.c_str(), O_RDONLY);
+  if (descriptor == -1) {
+    throw std::runtime_error("No se pudo abrir el fichero: " + nombre);
+  }
+  struct stat informacion{};
+  if (::fstat(descriptor, &informacion) == -1) {
+    ::close(descriptor);
+    throw std::runtime_error("No se pudo consultar el tamaño del fichero: " + nombre);
+  }
+  tamano_ = static_cast<size_t>(informacion.st_size);
+  if (tamano_ > 0) {
+    void* proyeccion = ::mmap(nullptr, tamano_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (proyeccion == MAP_FAILED) {
+      ::close(descriptor);
+      throw std::runtime_error("No se pudo proyectar en memoria el fichero: " + nombre);
+    }
+    ::madvise(proyeccion, tamano_, MADV_SEQUENTIAL);
+    datos_ = static_cast<const char*>(proyeccion);
+  }
+  // La proyección sigue siendo válida después de cerrar el descriptor
+  ::close(descriptor);
+}
+
+/**
+ * @brief Libera la proyección del fichero
+ */
+FicheroMapeado::~FicheroMapeado() {
+  if (datos_ != nullptr) {
+    ::munmap(const_cast<char*>(datos_), tamano_);
+  }
+}
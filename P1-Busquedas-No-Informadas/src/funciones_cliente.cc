@@ -14,9 +14,18 @@
 
 #include "funciones_cliente.h"
 #include "grafo.h"
+#include "tabla_caminos.h"
 #include <iostream>
 #include <fstream> // Fichero de cabezera para trabajar con ficheros
 #include <string> // std::string
+#include <stdexcept>
+#include <chrono> // Medición del benchmark
+#include <limits>
+#include <algorithm>
+#include <thread> // std::thread::hardware_concurrency
+#include <sstream> // Lectura de consultas por lotes
+#include <iomanip>
+#include <vector>
 
 /**
  * @brief Comprueba los datos introducidos por parametros sean los esperados.
@@ -74,6 +83,32 @@ void Usage(void) {
   std::cout << "  input.txt    (obligatorio) Fichero de entrada con la definición del grafo." << std::endl;
   std::cout << "  output.txt   (opcional)    Nombre del fichero donde guardar la salida generada." << std::endl;
   std::cout << std::endl;
+  std::cout << "Modo conversión: ./BusquedasNoInformadas --convertir input.txt grafo.bin" << std::endl;
+  std::cout << "  Guarda el grafo en una instantánea binaria que se carga sin parsear (mmap)." << std::endl;
+  std::cout << "  El fichero .bin puede usarse después como input en lugar del de texto." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Modo por lotes: ./BusquedasNoInformadas --lote input.txt consultas.txt salida.txt [hilos]" << std::endl;
+  std::cout << "  Resuelve en paralelo una consulta 'origen destino algoritmo' por línea de consultas.txt" << std::endl;
+  std::cout << "  (algoritmo: bfs, dfs, ucs o bidireccional) y escribe una línea de resultado por consulta." << std::endl;
+  std::cout << "  Por defecto usa todos los núcleos y traza 'resumen'." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Modo tabla: ./BusquedasNoInformadas --tabla-caminos input.txt tabla.bin [hilos]" << std::endl;
+  std::cout << "  Calcula los caminos de coste mínimo entre todos los pares de vértices y guarda la" << std::endl;
+  std::cout << "  tabla de distancias y siguientes saltos (12 * n * n bytes) en tabla.bin." << std::endl;
+  std::cout << "Consulta de tabla: ./BusquedasNoInformadas --consultar-tabla tabla.bin consultas.txt salida.txt" << std::endl;
+  std::cout << "  Responde las consultas 'origen destino' leyendo la tabla, sin cargar el grafo ni buscar." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Modo benchmark: ./BusquedasNoInformadas --benchmark-bfs input.txt [hilos]" << std::endl;
+  std::cout << "  Mide el BFS paralelo por niveles con 1, 2, 4, ... hasta 'hilos' hilos (por defecto" << std::endl;
+  std::cout << "  todos los núcleos) y muestra la aceleración respecto a un hilo." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Opciones:" << std::endl;
+  std::cout << "  --traza=NIVEL  Cantidad de traza que registran las búsquedas (por defecto 'iteracion'):" << std::endl;
+  std::cout << "                 ninguno   solo el camino y su coste" << std::endl;
+  std::cout << "                 resumen   además, número de iteraciones y de nodos" << std::endl;
+  std::cout << "                 iteracion además, nodos generados/inspeccionados en cada iteración" << std::endl;
+  std::cout << "                 vecino    además, cada vecino examinado por std::cerr" << std::endl;
+  std::cout << std::endl;
   std::cout << "Notas:" << std::endl;
   std::cout << "  - El constructor de la clase Grafo recibe 'input.txt' como único parámetro obligatorio." << std::endl;
   std::cout << "  - Si no se especifica 'output.txt', la salida se mostrará por un nombre definido ya." << std::endl;
@@ -82,9 +117,360 @@ void Usage(void) {
   std::cout << "Ejemplos:" << std::endl;
   std::cout << "  ./BusquedasNoInformadas datos/grafo01.txt" << std::endl;
   std::cout << "  ./BusquedasNoInformadas datos/grafo01.txt resultados.txt" << std::endl;
+  std::cout << "  ./BusquedasNoInformadas datos/grafo01.txt resultados.txt --traza=ninguno" << std::endl;
+  std::cout << "  ./BusquedasNoInformadas --convertir datos/grafo01.txt datos/grafo01.bin" << std::endl;
   std::cout << std::endl;
 }
 
+/**
+ * @brief Convierte un grafo (texto o binario) en una instantánea binaria
+ * 
+ * @param entrada Fichero del grafo a cargar
+ * @param salida Fichero binario a generar
+ * @return int Código de salida del programa (0 si todo fue bien)
+ */
+int ConvertirAInstantanea(const std::string& entrada, const std::string& salida) {
+  try {
+    Grafo grafo;
+    grafo.ProcesarGrafo(entrada);
+    grafo.GuardarInstantanea(salida);
+    std::cout << "Grafo cargado en " << grafo.tiempo_carga_ms() << " ms (" << grafo.numero_nodos()
+              << " nodos, " << grafo.numero_aristas() << " aristas)\n";
+    std::cout << "Instantánea binaria guardada en: " << salida << "\n";
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Convierte el nombre de un algoritmo del fichero de consultas en AlgoritmoBusqueda
+ * 
+ * @param nombre Nombre (bfs, dfs, ucs, bidireccional) o número de opción del menú (1-4)
+ * @param algoritmo Algoritmo leído
+ * @return false si el nombre no corresponde a ningún algoritmo
+ */
+static bool LeerAlgoritmo(const std::string& nombre, AlgoritmoBusqueda& algoritmo) {
+  if (nombre == "bfs" || nombre == "BFS" || nombre == "1") {
+    algoritmo = AlgoritmoBusqueda::kBFS;
+  } else if (nombre == "dfs" || nombre == "DFS" || nombre == "2") {
+    algoritmo = AlgoritmoBusqueda::kDFS;
+  } else if (nombre == "ucs" || nombre == "UCS" || nombre == "3") {
+    algoritmo = AlgoritmoBusqueda::kUCS;
+  } else if (nombre == "bidireccional" || nombre == "BIDIRECCIONAL" || nombre == "4") {
+    algoritmo = AlgoritmoBusqueda::kBFSBidireccional;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Nombre con el que se escribe un algoritmo en la salida por lotes
+ */
+static const char* NombreAlgoritmo(AlgoritmoBusqueda algoritmo) {
+  switch (algoritmo) {
+    case AlgoritmoBusqueda::kDFS: return "DFS";
+    case AlgoritmoBusqueda::kUCS: return "UCS";
+    case AlgoritmoBusqueda::kBFSBidireccional: return "BIDIRECCIONAL";
+    case AlgoritmoBusqueda::kBFS:
+    default: return "BFS";
+  }
+}
+
+/**
+ * @brief Lee un fichero de consultas "origen destino [algoritmo]", una por línea
+ * 
+ * @param nombre_fichero Ruta del fichero de consultas
+ * @param numero_nodos Número de nodos del grafo, para validar los vértices
+ * @return std::vector<ConsultaGrafo> Consultas con los vértices ya en base 0
+ * @throw std::runtime_error Si el fichero no se puede abrir o alguna línea no es válida
+ * 
+ * Los vértices van en base 1 como en el modo interactivo. Si falta el algoritmo se usa
+ * BFS. Las líneas vacías y las que empiezan por '#' se ignoran.
+ */
+std::vector<ConsultaGrafo> LeerConsultas(const std::string& nombre_fichero, int numero_nodos) {
+  std::ifstream fichero{nombre_fichero};
+  if (!fichero.is_open()) {
+    throw std::runtime_error("No se pudo abrir el fichero de consultas: " + nombre_fichero);
+  }
+  std::vector<ConsultaGrafo> consultas;
+  std::string linea;
+  size_t numero_linea = 0;
+  while (std::getline(fichero, linea)) {
+    ++numero_linea;
+    std::istringstream campos{linea};
+    ConsultaGrafo consulta;
+    std::string algoritmo;
+    if (!(campos >> consulta.origen)) {
+      campos.clear();
+      std::string primero;
+      if (!(campos >> primero) || primero.front() == '#') continue;
+      throw std::runtime_error("Consulta no válida en la línea " + std::to_string(numero_linea) + ": '" + linea + "'");
+    }
+    if (!(campos >> consulta.destino) ||
+        ((campos >> algoritmo) && !LeerAlgoritmo(algoritmo, consulta.algoritmo))) {
+      throw std::runtime_error("Consulta no válida en la línea " + std::to_string(numero_linea) + ": '" + linea + "'");
+    }
+    if (consulta.origen < 1 || consulta.origen > numero_nodos ||
+        consulta.destino < 1 || consulta.destino > numero_nodos) {
+      throw std::runtime_error("Vértice fuera de rango en la línea " + std::to_string(numero_linea) + ": '" + linea + "'");
+    }
+    --consulta.origen;
+    --consulta.destino;
+    consultas.push_back(consulta);
+  }
+  return consultas;
+}
+
+/**
+ * @brief Resuelve un fichero de consultas en paralelo y escribe una línea por consulta
+ * 
+ * @param entrada Fichero del grafo (texto o instantánea binaria)
+ * @param fichero_consultas Fichero con las consultas (ver LeerConsultas)
+ * @param salida Fichero de resultados
+ * @param hilos Número de hilos (0 = todos los núcleos)
+ * @param nivel_traza Nivel de traza de las búsquedas
+ * @return int Código de salida del programa (0 si todo fue bien)
+ * 
+ * Cada línea de salida tiene el formato "origen destino algoritmo coste iteraciones camino",
+ * con los vértices en base 1, el camino como "1-2-5" y '-' en coste y camino si no lo hay.
+ */
+int EjecutarLote(const std::string& entrada, const std::string& fichero_consultas,
+                 const std::string& salida, unsigned hilos, NivelTraza nivel_traza) {
+  try {
+    Grafo grafo;
+    grafo.ProcesarGrafo(entrada);
+    grafo.set_nivel_traza(nivel_traza);
+    std::cout << "Grafo cargado en " << grafo.tiempo_carga_ms() << " ms (" << grafo.numero_nodos()
+              << " nodos, " << grafo.numero_aristas() << " aristas)\n";
+    const std::vector<ConsultaGrafo> consultas = LeerConsultas(fichero_consultas, grafo.numero_nodos());
+    const auto inicio = std::chrono::steady_clock::now();
+    const std::vector<SearchResult> resultados = grafo.ResolverLote(consultas, hilos);
+    const auto fin = std::chrono::steady_clock::now();
+    std::ofstream archivo{salida};
+    if (!archivo.is_open()) {
+      throw std::runtime_error("No se pudo crear el fichero: " + salida);
+    }
+    archivo << "# origen destino algoritmo coste iteraciones camino\n";
+    archivo << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < consultas.size(); ++i) {
+      const ConsultaGrafo& consulta = consultas[i];
+      const SearchResult& resultado = resultados[i];
+      archivo << consulta.origen + 1 << ' ' << consulta.destino + 1 << ' ' 
+              << NombreAlgoritmo(consulta.algoritmo) << ' ';
+      if (resultado.path.empty()) {
+        archivo << "- " << resultado.logs.iterations << " -\n";
+        continue;
+      }
+      archivo << resultado.cost << ' ' << resultado.logs.iterations << ' ';
+      for (size_t j = 0; j < resultado.path.size(); ++j) {
+        archivo << resultado.path[j] + 1;
+        if (j < resultado.path.size() - 1) archivo << '-';
+      }
+      archivo << '\n';
+    }
+    std::cout << consultas.size() << " consultas resueltas en "
+              << std::chrono::duration<double, std::milli>(fin - inicio).count() << " ms\n";
+    std::cout << "Resultados guardados en: " << salida << "\n";
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Calcula la tabla de caminos mínimos entre todos los pares y la guarda en disco
+ * 
+ * @param entrada Fichero del grafo (texto o instantánea binaria)
+ * @param salida Fichero binario de la tabla a generar
+ * @param hilos Número de hilos (0 = todos los núcleos)
+ * @return int Código de salida del programa (0 si todo fue bien)
+ */
+int GenerarTablaCaminos(const std::string& entrada, const std::string& salida, unsigned hilos) {
+  try {
+    Grafo grafo;
+    grafo.ProcesarGrafo(entrada);
+    std::cout << "Grafo cargado en " << grafo.tiempo_carga_ms() << " ms (" << grafo.numero_nodos()
+              << " nodos, " << grafo.numero_aristas() << " aristas)\n";
+    const auto inicio = std::chrono::steady_clock::now();
+    const TablaCaminos tabla = grafo.CalcularTablaCaminos(hilos);
+    const auto fin = std::chrono::steady_clock::now();
+    tabla.Guardar(salida);
+    std::cout << "Tabla de caminos calculada en "
+              << std::chrono::duration<double, std::milli>(fin - inicio).count() << " ms\n";
+    std::cout << "Tabla de caminos guardada en: " << salida << "\n";
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Responde un fichero de consultas leyendo una tabla de caminos ya calculada
+ * 
+ * @param fichero_tabla Tabla generada con --tabla-caminos
+ * @param fichero_consultas Fichero con las consultas (ver LeerConsultas; el algoritmo se ignora)
+ * @param salida Fichero de resultados
+ * @return int Código de salida del programa (0 si todo fue bien)
+ * 
+ * No carga el grafo ni busca: cada respuesta es el camino de coste mínimo (el mismo coste
+ * que UCS) leído de la tabla. Cada línea de salida tiene el formato "origen destino coste
+ * camino", con los vértices en base 1 y '-' en coste y camino si no lo hay.
+ */
+int ConsultarTablaCaminos(const std::string& fichero_tabla, const std::string& fichero_consultas,
+                          const std::string& salida) {
+  try {
+    const TablaCaminos tabla{fichero_tabla};
+    std::cout << "Tabla de caminos cargada en " << tabla.tiempo_carga_ms() << " ms ("
+              << tabla.numero_nodos() << " nodos)\n";
+    const std::vector<ConsultaGrafo> consultas = LeerConsultas(fichero_consultas, tabla.numero_nodos());
+    std::ofstream archivo{salida};
+    if (!archivo.is_open()) {
+      throw std::runtime_error("No se pudo crear el fichero: " + salida);
+    }
+    const auto inicio = std::chrono::steady_clock::now();
+    archivo << "# origen destino coste camino\n";
+    archivo << std::fixed << std::setprecision(2);
+    for (const ConsultaGrafo& consulta : consultas) {
+      const std::vector<int> camino = tabla.Camino(consulta.origen, consulta.destino);
+      archivo << consulta.origen + 1 << ' ' << consulta.destino + 1 << ' ';
+      if (camino.empty()) {
+        archivo << "- -\n";
+        continue;
+      }
+      archivo << tabla.distancia(consulta.origen, consulta.destino) << ' ';
+      for (size_t j = 0; j < camino.size(); ++j) {
+        archivo << camino[j] + 1;
+        if (j < camino.size() - 1) archivo << '-';
+      }
+      archivo << '\n';
+    }
+    const auto fin = std::chrono::steady_clock::now();
+    std::cout << consultas.size() << " consultas resueltas en "
+              << std::chrono::duration<double, std::milli>(fin - inicio).count() << " ms\n";
+    std::cout << "Resultados guardados en: " << salida << "\n";
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Mide el BFS paralelo por niveles con distinto número de hilos
+ * 
+ * @param entrada Fichero del grafo (texto o instantánea binaria)
+ * @param hilos_max Número máximo de hilos a probar (se prueban 1, 2, 4, ... hasta él)
+ * @return int Código de salida del programa (0 si todo fue bien)
+ * 
+ * Para cada número de hilos calcula el árbol BFS completo desde el vértice 1, se queda con
+ * el mejor de varias repeticiones y muestra la aceleración respecto a un hilo. También
+ * comprueba que los niveles coinciden con los del BFS secuencial de dirección optimizada.
+ */
+int BenchmarkBFSParalelo(const std::string& entrada, unsigned hilos_max) {
+  const int kRepeticiones = 5;
+  try {
+    Grafo grafo;
+    grafo.ProcesarGrafo(entrada);
+    std::cout << "Grafo cargado en " << grafo.tiempo_carga_ms() << " ms (" << grafo.numero_nodos()
+              << " nodos, " << grafo.numero_aristas() << " aristas)\n";
+    // Mejor tiempo (ms) de varias repeticiones de una función
+    auto medir = [&](auto&& funcion) {
+      double mejor = std::numeric_limits<double>::max();
+      for (int i = 0; i < kRepeticiones; ++i) {
+        const auto inicio = std::chrono::steady_clock::now();
+        funcion();
+        const auto fin = std::chrono::steady_clock::now();
+        mejor = std::min(mejor, std::chrono::duration<double, std::milli>(fin - inicio).count());
+      }
+      return mejor;
+    };
+    ArbolBFS referencia;
+    const double ms_secuencial = medir([&] { referencia = grafo.ArbolBFSDireccionOptimizada(0); });
+    std::cout << "BFS secuencial (dirección optimizada): " << ms_secuencial << " ms, "
+              << referencia.orden.size() << " nodos alcanzables, " << referencia.niveles() << " niveles\n";
+    std::cout << "Hilos | Tiempo (ms) | Aceleración | Niveles correctos\n";
+    double ms_un_hilo = 0.0;
+    for (unsigned hilos = 1; hilos <= hilos_max; hilos *= 2) {
+      ArbolBFS arbol;
+      const double ms = medir([&] { arbol = grafo.ArbolBFSParalelo(0, hilos); });
+      if (hilos == 1) ms_un_hilo = ms;
+      std::cout << hilos << " | " << ms << " | " << ms_un_hilo / ms << " | "
+                << (arbol.nivel == referencia.nivel ? "sí" : "NO") << "\n";
+    }
+    std::cout << "Núcleos disponibles: " << std::thread::hardware_concurrency() << "\n";
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Busca la opción --traza=NIVEL entre los parámetros y la retira de argv
+ * 
+ * @param argc Numero de parametros (se decrementa si se encuentra la opción)
+ * @param argv Array de parametros (se compacta si se encuentra la opción)
+ * @param nivel Nivel de traza leído (no se modifica si no aparece la opción)
+ * @return false si el nivel indicado no es válido
+ */
+bool ExtraerNivelTraza(int& argc, char** argv, NivelTraza& nivel) {
+  const std::string prefijo{"--traza="};
+  for (int i = 1; i < argc; ++i) {
+    const std::string parametro{argv[i]};
+    if (parametro.rfind(prefijo, 0) != 0) continue;
+    const std::string valor = parametro.substr(prefijo.size());
+    if (valor == "ninguno") {
+      nivel = NivelTraza::kNinguno;
+    } else if (valor == "resumen") {
+      nivel = NivelTraza::kResumen;
+    } else if (valor == "iteracion") {
+      nivel = NivelTraza::kIteracion;
+    } else if (valor == "vecino") {
+      nivel = NivelTraza::kVecino;
+    } else {
+      std::cerr << "Nivel de traza no válido: '" << valor 
+                << "' (use ninguno, resumen, iteracion o vecino)" << std::endl;
+      return false;
+    }
+    for (int j = i; j < argc - 1; ++j) {
+      argv[j] = argv[j + 1];
+    }
+    argv[--argc] = nullptr;
+    --i;
+  }
+  return true;
+}
+
+/**
+ * @brief Lee el número de hilos de los modos --benchmark-bfs, --tabla-caminos y --lote
+ * 
+ * @param valor Texto del parámetro
+ * @param hilos Número leído (no se modifica si no es válido)
+ * @return false si no es un entero entre 0 y kMaxHilos; muestra el modo de empleo
+ */
+bool LeerNumeroHilos(const std::string& valor, unsigned& hilos) {
+  // Más hilos que esto no tiene sentido y el benchmark dobla el número hasta alcanzarlo
+  constexpr unsigned long kMaxHilos = 1024;
+  try {
+    size_t leidos = 0;
+    const unsigned long leido = std::stoul(valor, &leidos);
+    // stoul acepta negativos (los convierte en módulo 2^64)
+    if (leidos == valor.size() && valor.find('-') == std::string::npos && leido <= kMaxHilos) {
+      hilos = static_cast<unsigned>(leido);
+      return true;
+    }
+  } catch (const std::exception&) {
+  }
+  std::cerr << "Número de hilos no válido: '" << valor << "' (debe estar entre 0 y " << kMaxHilos << ")\n"
+               "Pruebe ‘BusquedasNoInformadas --help’ para más información." << std::endl;
+  return false;
+}
+
 /**
  * @brief Genera un archivo de salida con los resultados de la búsqueda en el grafo.
  * 
@@ -111,7 +497,8 @@ void GenerarOutput(const SearchResult& resultado, const Grafo& grafo, int origen
   archivo << "--------------------------------------------------\n\n";
   // Iteraciones
   for (size_t i = 0; i < resultado.logs.size(); ++i) {
-    const auto& log = resultado.logs[i];
+    // Vista acumulada de la iteración, reconstruida a partir de los deltas
+    const IterationLog log = resultado.logs[i];
     archivo << "Iteración " << i + 1 << "\n";
     // Nodos generados (acumulados)
     archivo << "Nodos generados: ";
@@ -137,6 +524,13 @@ void GenerarOutput(const SearchResult& resultado, const Grafo& grafo, int origen
     archivo << "\n";
     archivo << "--------------------------------------------------\n";
   }
+  // Con traza de resumen solo se conocen los totales
+  if (grafo.nivel_traza() == NivelTraza::kResumen) {
+    archivo << "Iteraciones: " << resultado.logs.iterations << "\n";
+    archivo << "Nodos generados: " << resultado.logs.generated_count << "\n";
+    archivo << "Nodos inspeccionados: " << resultado.logs.inspected_count << "\n";
+    archivo << "--------------------------------------------------\n";
+  }
   // Separador antes del resultado final
   archivo << "\n";
   // Resultado final
@@ -166,6 +560,9 @@ void Menu(Grafo& grafo, int origen, int destino, const std::string& outputfile)
   std::cout << "\nSeleccione algoritmo:\n";
   std::cout << "1. BFS (Búsqueda en Amplitud)\n";
   std::cout << "2. DFS (Búsqueda en Profundidad)\n";
+  std::cout << "3. UCS (Búsqueda de Coste Uniforme / Dijkstra)\n";
+  std::cout << "4. BFS bidireccional (Búsqueda en Amplitud desde ambos extremos)\n";
+  std::cout << "5. BFS de alcance con dirección optimizada (top-down/bottom-up)\n";
   std::cout << "Opción: ";
   std::cin >> opcion;
   if (opcion == 1) {
@@ -189,7 +586,7 @@ void Menu(Grafo& grafo, int origen, int destino, const std::string& outputfile)
     } else {
       std::cout << "No se encontró camino\n";
     }
-    std::cout << "Iteraciones BFS: " << resultado_bfs.logs.size() << "\n";
+    std::cout << "Iteraciones BFS: " << resultado_bfs.logs.iterations << "\n";
     std::cout << "Resultados BFS guardados en: " << archivo_salida_bfs << "\n\n";
   }
   if (opcion == 2) {
@@ -213,8 +610,85 @@ void Menu(Grafo& grafo, int origen, int destino, const std::string& outputfile)
     } else {
       std::cout << "No se encontró camino\n";
     }
-    std::cout << "Iteraciones DFS: " << resultado_dfs.logs.size() << "\n";
+    std::cout << "Iteraciones DFS: " << resultado_dfs.logs.iterations << "\n";
     std::cout << "Resultados DFS guardados en: " << archivo_salida_dfs << "\n\n";
   }
+  if (opcion == 3) {
+    std::cout << "\n=== EJECUTANDO UCS ===\n";
+    SearchResult resultado_ucs = grafo.UCS(origen, destino);
+    std::string archivo_salida_ucs{};
+    if (outputfile != "") {
+      archivo_salida_ucs = outputfile;
+    } else {
+      archivo_salida_ucs = "resultado_ucs.txt";
+    }
+    GenerarOutput(resultado_ucs, grafo, origen, destino, archivo_salida_ucs, "UCS");
+    std::cout << "=== RESULTADO UCS ===\n";
+    if (!resultado_ucs.path.empty()) {
+      std::cout << "Camino encontrado: ";
+      for (size_t i = 0; i < resultado_ucs.path.size(); ++i) {
+        std::cout << resultado_ucs.path[i] + 1;
+        if (i < resultado_ucs.path.size() - 1) std::cout << " -> ";
+      }
+      std::cout << "\nCosto: " << resultado_ucs.cost << "\n";
+    } else {
+      std::cout << "No se encontró camino\n";
+    }
+    std::cout << "Iteraciones UCS: " << resultado_ucs.logs.iterations << "\n";
+    std::cout << "Resultados UCS guardados en: " << archivo_salida_ucs << "\n\n";
+  }
+  if (opcion == 4) {
+    std::cout << "\n=== EJECUTANDO BFS BIDIRECCIONAL ===\n";
+    SearchResult resultado_bidireccional = grafo.BFSBidireccional(origen, destino);
+    std::string archivo_salida_bidireccional{};
+    if (outputfile != "") {
+      archivo_salida_bidireccional = outputfile;
+    } else {
+      archivo_salida_bidireccional = "resultado_bfs_bidireccional.txt";
+    }
+    GenerarOutput(resultado_bidireccional, grafo, origen, destino, archivo_salida_bidireccional,
+                  "BFS bidireccional");
+    std::cout << "=== RESULTADO BFS BIDIRECCIONAL ===\n";
+    if (!resultado_bidireccional.path.empty()) {
+      std::cout << "Camino encontrado: ";
+      for (size_t i = 0; i < resultado_bidireccional.path.size(); ++i) {
+        std::cout << resultado_bidireccional.path[i] + 1;
+        if (i < resultado_bidireccional.path.size() - 1) std::cout << " -> ";
+      }
+      std::cout << "\nCosto: " << resultado_bidireccional.cost << "\n";
+    } else {
+      std::cout << "No se encontró camino\n";
+    }
+    std::cout << "Iteraciones BFS bidireccional: " << resultado_bidireccional.logs.iterations << "\n";
+    std::cout << "Resultados BFS bidireccional guardados en: " << archivo_salida_bidireccional << "\n\n";
+  }
+  if (opcion == 5) {
+    std::cout << "\n=== EJECUTANDO BFS CON DIRECCIÓN OPTIMIZADA ===\n";
+    const ArbolBFS arbol = grafo.ArbolBFSDireccionOptimizada(origen);
+    SearchResult resultado_alcance = grafo.ResultadoDesdeArbol(arbol, destino);
+    std::string archivo_salida_alcance{};
+    if (outputfile != "") {
+      archivo_salida_alcance = outputfile;
+    } else {
+      archivo_salida_alcance = "resultado_bfs_alcance.txt";
+    }
+    GenerarOutput(resultado_alcance, grafo, origen, destino, archivo_salida_alcance,
+                  "BFS con dirección optimizada");
+    std::cout << "=== RESULTADO BFS CON DIRECCIÓN OPTIMIZADA ===\n";
+    std::cout << "Nodos alcanzables: " << arbol.orden.size() << "\n";
+    std::cout << "Niveles: " << arbol.niveles() << " (" << arbol.pasos_bottom_up << " bottom-up)\n";
+    std::cout << "Aristas examinadas: " << arbol.aristas_examinadas << "\n";
+    if (!resultado_alcance.path.empty()) {
+      std::cout << "Camino encontrado: ";
+      for (size_t i = 0; i < resultado_alcance.path.size(); ++i) {
+        std::cout << resultado_alcance.path[i] + 1;
+        if (i < resultado_alcance.path.size() - 1) std::cout << " -> ";
+      }
+      std::cout << "\nCosto: " << resultado_alcance.cost << "\n";
+    } else {
+      std::cout << "No se encontró camino\n";
+    }
+    std::cout << "Resultados BFS con dirección optimizada guardados en: " << archivo_salida_alcance << "\n\n";
+  }
   std::cout << "Búsqueda(s) completada(s).\n";
 }
\ No newline at end of file
@@ -22,5 +22,13 @@ void PrintProgramPorpouse(void);
 void Usage(void);
 void GenerarOutput(const SearchResult&, const Grafo&, int, int, const std::string&, const std::string&);
 void Menu(Grafo&, int, int, const std::string& outputfile);
+int ConvertirAInstantanea(const std::string&, const std::string&);
+bool ExtraerNivelTraza(int&, char**, NivelTraza&);
+bool LeerNumeroHilos(const std::string&, unsigned&);
+int BenchmarkBFSParalelo(const std::string&, unsigned);
+std::vector<ConsultaGrafo> LeerConsultas(const std::string&, int);
+int EjecutarLote(const std::string&, const std::string&, const std::string&, unsigned, NivelTraza);
+int GenerarTablaCaminos(const std::string&, const std::string&, unsigned);
+int ConsultarTablaCaminos(const std::string&, const std::string&, const std::string&);
 
 #endif
\ No newline at end of file
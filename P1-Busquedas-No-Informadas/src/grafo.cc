@@ -18,52 +18,338 @@
 #include <fstream>
 #include <iomanip>
 #include <algorithm>
-#include <queue> 
+#include <functional> // std::greater
+#include <utility>
+#include <charconv> // std::from_chars
+#include <chrono> // Tiempo de carga
+#include <cstring> // std::memchr
+#include <stdexcept>
+#include <string>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <atomic> // std::atomic, std::atomic_ref (BFS paralelo)
+#include <barrier> // Sincronización por niveles del BFS paralelo
+#include <thread>
+#include "fichero_mapeado.h"
 
 // ============================================================================
 // MÉTODOS DE CONSTRUCCIÓN Y VISUALIZACIÓN
 // ============================================================================
 
+/**
+ * @brief Lee el número de la línea actual de un buffer y avanza a la siguiente línea
+ * 
+ * @param cursor Posición actual en el buffer (se actualiza al inicio de la línea siguiente)
+ * @param fin Final del buffer
+ * @param linea Número de línea actual (base 1), usado en los mensajes de error
+ * @param valor Valor leído
+ * @return true Si se leyó un valor, false si no quedaban líneas
+ * @throw std::runtime_error Si la línea no contiene un número válido
+ * 
+ * Usa std::from_chars, por lo que no crea ningún std::string intermedio.
+ * Como std::stod, lee el prefijo numérico de la línea ("9,00" se lee como 9).
+ */
+template <typename T>
+static bool LeerValorLinea(const char*& cursor, const char* fin, size_t linea, T& valor) {
+  if (cursor >= fin) {
+    return false;
+  }
+  const char* fin_linea = static_cast<const char*>(std::memchr(cursor, '\n', fin - cursor));
+  if (fin_linea == nullptr) {
+    fin_linea = fin;
+  }
+  const char* inicio = cursor;
+  cursor = (fin_linea == fin) ? fin : fin_linea + 1;
+  while (inicio < fin_linea && (*inicio == ' ' || *inicio == '\t')) ++inicio;
+  if (inicio < fin_linea && *inicio == '+') ++inicio;
+  // Igual que std::stod/std::stoi: se lee el prefijo numérico y se ignora el resto de la línea
+  if (std::from_chars(inicio, fin_linea, valor).ec != std::errc{}) {
+    throw std::runtime_error("Valor no válido en la línea " + std::to_string(linea) + ": '" +
+                             std::string(inicio, fin_linea) + "'");
+  }
+  return true;
+}
+
 /**
  * @brief Carga un grafo desde un archivo de texto con formato específico
  * 
  * @param inputfile Ruta del archivo que contiene la definición del grafo
- * @throw std::runtime_error Si el archivo está incompleto o no puede leerse
+ * @throw std::runtime_error Si el archivo está incompleto, tiene valores no numéricos
+ *        o no puede leerse (indicando la línea del error)
  * 
  * El formato del archivo debe ser:
  * - Primera línea: número de nodos
  * - Líneas siguientes: distancias entre pares de nodos (i,j) con i < j
  * - Las distancias son simétricas y -1 indica que no hay arista
  * - La diagonal principal se establece automáticamente a 0
+ *
+ * El fichero se proyecta en memoria con mmap y se recorre una sola vez con
+ * std::from_chars. Solo las distancias > 0 se guardan como aristas en la CSR.
+ * La matriz densa se rellena además si el grafo se construyó con
+ * matriz_densa = true. El tiempo de carga queda en tiempo_carga_ms().
+ *
+ * Si el fichero es una instantánea binaria (ver GuardarInstantanea) se usa
+ * directamente la proyección en memoria, sin parsear ni copiar.
+ *
+ * Si la carga falla el grafo conserva el contenido anterior: se lee todo en
+ * variables locales y solo al final se sustituye (y se libera la instantánea
+ * anterior, a la que aún apuntan las vistas CSR).
  */
 void Grafo::ProcesarGrafo(const std::string& inputfile) {
-  std::ifstream fichero_grafo{inputfile};
-  std::string line{};
-  getline(fichero_grafo, line);
-  numero_nodos_ = std::stoi(line);
-  // Inicializar matriz de adyacencia n x n con -1
-  matriz_adyacencia_.resize(numero_nodos_, std::vector<double>(numero_nodos_, -1.0));
-  // Diagonal principal a 0 (d(i,i) = 0)
-  for (int i = 0; i < numero_nodos_; ++i) {
-    matriz_adyacencia_[i][i] = 0.0;
+  const auto inicio_carga = std::chrono::steady_clock::now();
+  auto fichero = std::make_unique<FicheroMapeado>(inputfile);
+  if (EsInstantanea(*fichero)) {
+    CargarInstantanea(std::move(fichero));
+    tiempo_carga_ms_ = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - inicio_carga).count();
+    return;
   }
-  // Leer las distancias para los pares (i,j) donde i < j
-  for (int i = 0; i < numero_nodos_ - 1; ++i) {
-    for (int j = i + 1; j < numero_nodos_; ++j) {
-      if (!getline(fichero_grafo, line)) {
-        throw std::runtime_error("Archivo incompleto: se esperaban más datos");
+  const FicheroMapeado& fichero_grafo = *fichero;
+  const char* cursor = fichero_grafo.begin();
+  size_t linea = 1;
+  int numero_nodos{};
+  if (!LeerValorLinea(cursor, fichero_grafo.end(), linea, numero_nodos)) {
+    throw std::runtime_error("Archivo vacío: falta el número de nodos en la línea 1");
+  }
+  if (numero_nodos < 0) {
+    throw std::runtime_error("Número de nodos negativo en la línea 1");
+  }
+  int numero_aristas = 0;
+  std::vector<std::vector<double>> matriz_adyacencia{};
+  if (usar_matriz_densa_) {
+    // Inicializar matriz de adyacencia n x n con -1 y diagonal principal a 0 (d(i,i) = 0)
+    matriz_adyacencia.assign(numero_nodos, std::vector<double>(numero_nodos, -1.0));
+    for (int i = 0; i < numero_nodos; ++i) {
+      matriz_adyacencia[i][i] = 0.0;
+    }
+  }
+  // Leer las distancias para los pares (i,j) donde i < j, guardando solo las aristas
+  std::vector<int> origenes{};
+  std::vector<int> destinos{};
+  std::vector<double> distancias{};
+  std::vector<size_t> grado(numero_nodos, 0);
+  const size_t pares_esperados = static_cast<size_t>(numero_nodos) * (numero_nodos > 0 ? numero_nodos - 1 : 0) / 2;
+  for (int i = 0; i < numero_nodos - 1; ++i) {
+    for (int j = i + 1; j < numero_nodos; ++j) {
+      ++linea;
+      double distancia{};
+      if (!LeerValorLinea(cursor, fichero_grafo.end(), linea, distancia)) {
+        throw std::runtime_error("Archivo incompleto en la línea " + std::to_string(linea) +
+                                 ": se esperaban " + std::to_string(pares_esperados) +
+                                 " distancias y solo hay " + std::to_string(linea - 2));
+      }
+      if (usar_matriz_densa_) {
+        // Asignar distancia simétrica
+        matriz_adyacencia[i][j] = distancia;
+        matriz_adyacencia[j][i] = distancia;
       }
-      double distancia = std::stod(line);
-      // Asignar distancia simétrica
-      matriz_adyacencia_[i][j] = distancia;
-      matriz_adyacencia_[j][i] = distancia;
       // Contar aristas (si distancia > 0, hay arista)
       if (distancia > 0) {
-        numero_aristas_++;
+        numero_aristas++;
+        origenes.push_back(i);
+        destinos.push_back(j);
+        distancias.push_back(distancia);
+        ++grado[i];
+        ++grado[j];
       }
     }
   }
-  fichero_grafo.close();
+  numero_nodos_ = numero_nodos;
+  numero_aristas_ = numero_aristas;
+  matriz_adyacencia_ = std::move(matriz_adyacencia);
+  ConstruirCSR(origenes, destinos, distancias, grado);
+  instantanea_.reset();
+  tiempo_carga_ms_ = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - inicio_carga).count();
+}
+
+/**
+ * @brief Construye la representación CSR a partir de la lista de aristas
+ * 
+ * @param origenes Nodo menor de cada arista (no decreciente)
+ * @param destinos Nodo mayor de cada arista
+ * @param distancias Peso de cada arista
+ * @param grado Número de aristas incidentes en cada nodo
+ * 
+ * Como las aristas llegan ordenadas por (i, j) con i < j, al insertarlas en
+ * ese orden cada fila de la CSR queda ordenada de menor a mayor vecino, que
+ * es el mismo orden en que la matriz densa devolvía los vecinos.
+ */
+void Grafo::ConstruirCSR(const std::vector<int>& origenes, const std::vector<int>& destinos,
+                         const std::vector<double>& distancias, const std::vector<size_t>& grado) {
+  almacen_offsets_.assign(numero_nodos_ + 1, 0);
+  for (int i = 0; i < numero_nodos_; ++i) {
+    almacen_offsets_[i + 1] = almacen_offsets_[i] + grado[i];
+  }
+  almacen_vecinos_.assign(almacen_offsets_[numero_nodos_], -1);
+  almacen_pesos_.assign(almacen_offsets_[numero_nodos_], 0.0);
+  std::vector<size_t> siguiente(almacen_offsets_.begin(), almacen_offsets_.end() - 1);
+  for (size_t k = 0; k < origenes.size(); ++k) {
+    const int i = origenes[k];
+    const int j = destinos[k];
+    almacen_vecinos_[siguiente[i]] = j;
+    almacen_pesos_[siguiente[i]++] = distancias[k];
+    almacen_vecinos_[siguiente[j]] = i;
+    almacen_pesos_[siguiente[j]++] = distancias[k];
+  }
+  offsets_ = almacen_offsets_;
+  vecinos_ = almacen_vecinos_;
+  pesos_ = almacen_pesos_;
+}
+
+// ============================================================================
+// INSTANTÁNEAS BINARIAS
+// ============================================================================
+
+/**
+ * Cabecera de una instantánea binaria de Grafo (versión 1, little-endian)
+ * 
+ * Tras la cabecera van, alineados a 8 bytes:
+ * - offsets: (numero_nodos + 1) x uint64
+ * - vecinos: numero_entradas x int32 (+ relleno hasta múltiplo de 8)
+ * - pesos:   numero_entradas x double
+ */
+struct CabeceraInstantaneaGrafo {
+  char magia[8];
+  uint32_t version;
+  uint32_t orden_bytes;
+  uint64_t numero_nodos;
+  uint64_t numero_aristas;
+  uint64_t numero_entradas;
+};
+
+static constexpr char kMagiaGrafo[8] = {'I', 'A', 'G', 'R', 'A', 'F', 'O', '\0'};
+static constexpr uint32_t kVersionInstantaneaGrafo = 1;
+static constexpr uint32_t kOrdenBytes = 0x01020304;
+static_assert(sizeof(size_t) == sizeof(uint64_t), "La instantánea asume size_t de 64 bits");
+static_assert(sizeof(int) == sizeof(int32_t), "La instantánea asume int de 32 bits");
+
+/**
+ * @brief Redondea un tamaño en bytes al siguiente múltiplo de 8
+ */
+static size_t Alinear8(size_t bytes) {
+  return (bytes + 7) & ~static_cast<size_t>(7);
+}
+
+/**
+ * @brief Comprueba si un fichero empieza por la marca de instantánea de Grafo
+ * 
+ * @param fichero Fichero proyectado en memoria
+ * @return true Si es una instantánea binaria, false si debe tratarse como texto
+ */
+bool Grafo::EsInstantanea(const FicheroMapeado& fichero) {
+  return fichero.size() >= sizeof(kMagiaGrafo) &&
+         std::memcmp(fichero.data(), kMagiaGrafo, sizeof(kMagiaGrafo)) == 0;
+}
+
+/**
+ * @brief Guarda el grafo en una instantánea binaria
+ * 
+ * @param outputfile Ruta del fichero binario a crear
+ * @throw std::runtime_error Si el fichero no se puede escribir
+ * 
+ * El fichero resultante se puede pasar como entrada en lugar del de texto.
+ */
+void Grafo::GuardarInstantanea(const std::string& outputfile) const {
+  std::ofstream fichero{outputfile, std::ios::binary};
+  if (!fichero.is_open()) {
+    throw std::runtime_error("No se pudo crear el fichero: " + outputfile);
+  }
+  CabeceraInstantaneaGrafo cabecera{};
+  std::memcpy(cabecera.magia, kMagiaGrafo, sizeof(kMagiaGrafo));
+  cabecera.version = kVersionInstantaneaGrafo;
+  cabecera.orden_bytes = kOrdenBytes;
+  cabecera.numero_nodos = static_cast<uint64_t>(numero_nodos_);
+  cabecera.numero_aristas = static_cast<uint64_t>(numero_aristas_);
+  cabecera.numero_entradas = vecinos_.size();
+  const char relleno[8] = {};
+  fichero.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+  fichero.write(reinterpret_cast<const char*>(offsets_.data()), offsets_.size_bytes());
+  fichero.write(reinterpret_cast<const char*>(vecinos_.data()), vecinos_.size_bytes());
+  fichero.write(relleno, Alinear8(vecinos_.size_bytes()) - vecinos_.size_bytes());
+  fichero.write(reinterpret_cast<const char*>(pesos_.data()), pesos_.size_bytes());
+  if (!fichero) {
+    throw std::runtime_error("Error al escribir el fichero: " + outputfile);
+  }
+}
+
+/**
+ * @brief Carga el grafo desde una instantánea binaria proyectada en memoria
+ * 
+ * @param fichero Proyección del fichero (el grafo pasa a ser su dueño)
+ * @throw std::runtime_error Si la cabecera o los tamaños no son coherentes
+ * 
+ * Los arrays CSR apuntan directamente a la proyección, así que la carga no
+ * copia datos y es prácticamente instantánea. Se valida la cabecera, los
+ * tamaños, que los offsets no decrezcan y que cada vecino sea un nodo válido,
+ * todo sobre vistas locales: si algo falla el grafo conserva el contenido anterior.
+ */
+void Grafo::CargarInstantanea(std::unique_ptr<FicheroMapeado> fichero) {
+  CabeceraInstantaneaGrafo cabecera{};
+  if (fichero->size() < sizeof(cabecera)) {
+    throw std::runtime_error("Instantánea de grafo truncada: falta la cabecera");
+  }
+  std::memcpy(&cabecera, fichero->data(), sizeof(cabecera));
+  if (cabecera.version != kVersionInstantaneaGrafo) {
+    throw std::runtime_error("Versión de instantánea de grafo no soportada: " + std::to_string(cabecera.version));
+  }
+  if (cabecera.orden_bytes != kOrdenBytes) {
+    throw std::runtime_error("Instantánea de grafo creada con otro orden de bytes");
+  }
+  // Acotar los contadores antes de multiplicarlos: un fichero corrupto podría desbordar los productos
+  if (cabecera.numero_nodos > static_cast<uint64_t>(std::numeric_limits<int>::max()) ||
+      cabecera.numero_entradas > fichero->size() / sizeof(double)) {
+    throw std::runtime_error("Instantánea de grafo con tamaño incoherente");
+  }
+  const size_t bytes_offsets = (cabecera.numero_nodos + 1) * sizeof(uint64_t);
+  const size_t bytes_vecinos = Alinear8(cabecera.numero_entradas * sizeof(int32_t));
+  const size_t bytes_pesos = cabecera.numero_entradas * sizeof(double);
+  if (fichero->size() != sizeof(cabecera) + bytes_offsets + bytes_vecinos + bytes_pesos) {
+    throw std::runtime_error("Instantánea de grafo con tamaño incoherente");
+  }
+  const char* datos = fichero->data() + sizeof(cabecera);
+  const int numero_nodos = static_cast<int>(cabecera.numero_nodos);
+  const std::span<const size_t> offsets{reinterpret_cast<const size_t*>(datos), cabecera.numero_nodos + 1};
+  const std::span<const int> vecinos{reinterpret_cast<const int*>(datos + bytes_offsets), cabecera.numero_entradas};
+  const std::span<const double> pesos{reinterpret_cast<const double*>(datos + bytes_offsets + bytes_vecinos),
+                                      cabecera.numero_entradas};
+  if (offsets.front() != 0 || offsets.back() != cabecera.numero_entradas) {
+    throw std::runtime_error("Instantánea de grafo con offsets incoherentes");
+  }
+  // Un recorrido O(V + E): las búsquedas indexan con offsets y vecinos sin comprobar límites
+  for (size_t i = 1; i < offsets.size(); ++i) {
+    if (offsets[i] < offsets[i - 1]) {
+      throw std::runtime_error("Instantánea de grafo con offsets incoherentes");
+    }
+  }
+  for (const int vecino : vecinos) {
+    if (vecino < 0 || vecino >= numero_nodos) {
+      throw std::runtime_error("Instantánea de grafo con un vecino fuera de rango: " + std::to_string(vecino));
+    }
+  }
+  std::vector<std::vector<double>> matriz_adyacencia{};
+  if (usar_matriz_densa_) {
+    // La matriz densa se reconstruye desde la CSR
+    matriz_adyacencia.assign(numero_nodos, std::vector<double>(numero_nodos, -1.0));
+    for (int i = 0; i < numero_nodos; ++i) {
+      matriz_adyacencia[i][i] = 0.0;
+      for (size_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+        matriz_adyacencia[i][vecinos[k]] = pesos[k];
+      }
+    }
+  }
+  // Todo es válido: se sustituye el grafo anterior
+  numero_nodos_ = numero_nodos;
+  numero_aristas_ = static_cast<int>(cabecera.numero_aristas);
+  offsets_ = offsets;
+  vecinos_ = vecinos;
+  pesos_ = pesos;
+  matriz_adyacencia_ = std::move(matriz_adyacencia);
+  almacen_offsets_.clear();
+  almacen_vecinos_.clear();
+  almacen_pesos_.clear();
+  instantanea_ = std::move(fichero);
 }
 
 /**
@@ -89,14 +375,24 @@ void Grafo::ImprimirMatriz() const {
     std::cout << "--------";
   }
   std::cout << "\n";
-  // Imprimir filas de la matriz
+  // Imprimir filas de la matriz (reconstruidas desde la CSR si no hay matriz densa)
+  std::vector<double> fila(numero_nodos_);
   for (int i = 0; i < numero_nodos_; ++i) {
+    if (usar_matriz_densa_) {
+      fila = matriz_adyacencia_[i];
+    } else {
+      std::fill(fila.begin(), fila.end(), -1.0);
+      fila[i] = 0.0;
+      for (size_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+        fila[vecinos_[k]] = pesos_[k];
+      }
+    }
     std::cout << std::setw(2) << i + 1 << " |";
     for (int j = 0; j < numero_nodos_; ++j) {
-      if (matriz_adyacencia_[i][j] == -1) {
+      if (fila[j] == -1) {
         std::cout << std::setw(8) << "INF";
       } else {
-        std::cout << std::setw(8) << std::fixed << std::setprecision(3) << matriz_adyacencia_[i][j];
+        std::cout << std::setw(8) << std::fixed << std::setprecision(3) << fila[j];
       }
     }
     std::cout << "\n";
@@ -111,20 +407,28 @@ void Grafo::ImprimirMatriz() const {
  * @brief Obtiene los nodos vecinos conectados a un nodo dado
  * 
  * @param nodo Índice del nodo del cual se quieren obtener los vecinos
- * @return std::vector<int> Lista de índices de nodos vecinos conectados
+ * @return std::span<const int> Vista (ordenada) de los índices de nodos vecinos en la CSR
  * @throw std::out_of_range Si el índice del nodo está fuera de rango
  */
-std::vector<int> Grafo::GetVecinos(int nodo) const {
+std::span<const int> Grafo::GetVecinos(int nodo) const {
   if (nodo < 0 || nodo >= numero_nodos_) {
     throw std::out_of_range("Índice de nodo fuera de rango");
   }
-  std::vector<int> vecinos{};
-  for (int i{0}; i < numero_nodos_; ++i) {
-    if (matriz_adyacencia_[nodo][i] > 0) {
-      vecinos.push_back(i);
-    }
+  return {vecinos_.data() + offsets_[nodo], offsets_[nodo + 1] - offsets_[nodo]};
+}
+
+/**
+ * @brief Obtiene los pesos de las aristas que salen de un nodo
+ * 
+ * @param nodo Índice del nodo
+ * @return std::span<const double> Vista de los pesos, alineada con GetVecinos(nodo)
+ * @throw std::out_of_range Si el índice del nodo está fuera de rango
+ */
+std::span<const double> Grafo::GetPesos(int nodo) const {
+  if (nodo < 0 || nodo >= numero_nodos_) {
+    throw std::out_of_range("Índice de nodo fuera de rango");
   }
-  return vecinos;
+  return {pesos_.data() + offsets_[nodo], offsets_[nodo + 1] - offsets_[nodo]};
 }
 
 /**
@@ -141,7 +445,10 @@ bool Grafo::ExisteArista(int nodo_origen, int nodo_destino) const {
       nodo_destino < 0 || nodo_destino >= numero_nodos_) {
     throw std::out_of_range("Índice de nodo fuera de rango");
   }
-  return (matriz_adyacencia_[nodo_origen][nodo_destino] > 0);
+  if (usar_matriz_densa_) {
+    return (matriz_adyacencia_[nodo_origen][nodo_destino] > 0);
+  }
+  return BuscarArista(nodo_origen, nodo_destino) != vecinos_.size();
 }
 
 /**
@@ -157,12 +464,38 @@ double Grafo::GetPeso(int nodo_origen, int nodo_destino) const {
       nodo_destino < 0 || nodo_destino >= numero_nodos_) {
     throw std::out_of_range("Índice de nodo fuera de rango");
   }
-  if (ExisteArista(nodo_origen, nodo_destino)) {
-    return matriz_adyacencia_[nodo_origen][nodo_destino];
+  if (usar_matriz_densa_) {
+    if (ExisteArista(nodo_origen, nodo_destino)) {
+      return matriz_adyacencia_[nodo_origen][nodo_destino];
+    }
+    return -2;
+  }
+  const size_t posicion = BuscarArista(nodo_origen, nodo_destino);
+  if (posicion != vecinos_.size()) {
+    return pesos_[posicion];
   } 
   return -2;
 }
 
+/**
+ * @brief Localiza una arista dentro de la fila CSR del nodo origen
+ * 
+ * @param nodo_origen Índice del nodo origen (válido)
+ * @param nodo_destino Índice del nodo destino (válido)
+ * @return size_t Posición de la arista en vecinos_/pesos_, o vecinos_.size() si no existe
+ * 
+ * Búsqueda binaria, ya que cada fila de la CSR está ordenada.
+ */
+size_t Grafo::BuscarArista(int nodo_origen, int nodo_destino) const {
+  const auto inicio = vecinos_.begin() + offsets_[nodo_origen];
+  const auto fin = vecinos_.begin() + offsets_[nodo_origen + 1];
+  const auto it = std::lower_bound(inicio, fin, nodo_destino);
+  if (it != fin && *it == nodo_destino) {
+    return static_cast<size_t>(it - vecinos_.begin());
+  }
+  return vecinos_.size();
+}
+
 // ============================================================================
 // MÉTODOS DE BÚSQUEDA NO INFORMADA
 // ============================================================================
@@ -182,55 +515,67 @@ double Grafo::GetPeso(int nodo_origen, int nodo_destino) const {
  * - Completo: Siempre encuentra solución si existe
  * - Óptimo: Encuentra el camino con menor número de aristas
  * - Complejidad: O(V + E) en tiempo y espacio
+ * 
+ * @note Lo que se registra en SearchResult::logs depende de nivel_traza()
+ */
+SearchResult Grafo::BFS(int nodo_origen, int nodo_destino) const {
+  SearchWorkspace espacio;
+  return BFS(nodo_origen, nodo_destino, espacio);
+}
+
+/**
+ * @brief BFS reutilizando los buffers de un SearchWorkspace (ver BFS(int, int))
+ * 
+ * @param nodo_origen Índice del nodo de inicio de la búsqueda
+ * @param nodo_destino Índice del nodo objetivo a encontrar
+ * @param espacio Buffers de trabajo; tras la primera consulta no se reserva memoria para ellos
+ * @return SearchResult Estructura con el camino encontrado, costo e historial de búsqueda
  */
-SearchResult Grafo::BFS(int nodo_origen, int nodo_destino) {
+SearchResult Grafo::BFS(int nodo_origen, int nodo_destino, SearchWorkspace& espacio) const {
   SearchResult r;
   if (nodo_origen < 0 || nodo_origen >= numero_nodos_ ||
       nodo_destino < 0 || nodo_destino >= numero_nodos_) {
     return r;
   }
-  std::vector<bool> visitado(numero_nodos_, false);
-  std::vector<int> padre(numero_nodos_, -1);
-  std::queue<int> q;
-  // Vectores acumulados para el log
-  std::vector<int> generados;
-  std::vector<int> inspeccionados;
+  r.logs = CrearLog();
+  const bool traza_vecinos = TrazarVecinos();
+  espacio.Preparar(numero_nodos_);
+  MarcasGeneracion& visitado = espacio.visitado;
+  std::vector<int>& padre = espacio.padre;
+  std::vector<int>& cola = espacio.cola;
+  cola.clear();
+  size_t cabeza = 0;
   // Inicialización
-  q.push(nodo_origen);
-  visitado[nodo_origen] = true;
-  generados.push_back(nodo_origen);
+  cola.push_back(nodo_origen);
+  visitado.Marcar(nodo_origen);
+  padre[nodo_origen] = -1;
+  r.logs.Generate(nodo_origen);
   // Iteración 1: antes de inspeccionar a nadie
-  {
-    IterationLog l;
-    l.generated_accumulated = generados;
-    l.inspected_accumulated = inspeccionados;
-    r.logs.push_back(l);
-  }
-  // Bucle principal: una extracción = una inspección = un snapshot
-  while (!q.empty()) {
-    const int u = q.front(); q.pop();
+  r.logs.EndIteration();
+  // Bucle principal: una extracción = una inspección = una iteración del log
+  while (cabeza < cola.size()) {
+    const int u = cola[cabeza++];
     // INSPECCIONAR SOLO 'u' EN ESTA ITERACIÓN
-    inspeccionados.push_back(u);
+    r.logs.Inspect(u);
     // Generar vecinos de 'u' y encolarlos si no estaban visitados
     for (int v : GetVecinos(u)) {
-      if (!visitado[v]) {
-        visitado[v] = true;
+      if (traza_vecinos) {
+        std::cerr << "  Vecino " << v + 1 << " de " << u + 1 
+                  << (visitado.Contiene(v) ? " (ya visitado)\n" : "\n");
+      }
+      if (!visitado.Contiene(v)) {
+        visitado.Marcar(v);
         padre[v] = u;
-        q.push(v);
-        generados.push_back(v);
+        cola.push_back(v);
+        r.logs.Generate(v);
       }
     }
-    // Snapshot tras inspeccionar 'u' (acumulados)
-    {
-      IterationLog l;
-      l.generated_accumulated = generados;
-      l.inspected_accumulated = inspeccionados;
-      r.logs.push_back(l);
-    }
+    // Fin de la iteración tras inspeccionar 'u' (solo se guardan los deltas)
+    r.logs.EndIteration();
     if (u == nodo_destino) break;
   }
   // Reconstrucción de camino y coste (si se llegó al destino)
-  if (visitado[nodo_destino]) {
+  if (visitado.Contiene(nodo_destino)) {
     std::vector<int> path;
     for (int v = nodo_destino; v != -1; v = padre[v]) {
       path.push_back(v);
@@ -248,104 +593,734 @@ SearchResult Grafo::BFS(int nodo_origen, int nodo_destino) {
 }
 
 /**
- * @brief Función auxiliar recursiva para el algoritmo de Búsqueda en Profundidad (DFS)
+ * @brief Implementa el algoritmo de Búsqueda en Profundidad (Depth-First Search)
+ * 
+ * @param nodo_origen Índice del nodo de inicio de la búsqueda
+ * @param nodo_destino Índice del nodo objetivo a encontrar
+ * @return SearchResult Estructura con el camino encontrado, costo e historial de búsqueda
+ * 
+ * El algoritmo DFS explora el grafo en profundidad, siguiendo cada rama hasta su final
+ * antes de retroceder y probar caminos alternativos. El backtracking se gestiona con una
+ * pila explícita reservada de antemano (un marco por nodo de la rama actual) en lugar de
+ * la pila de llamadas, por lo que cadenas de millones de nodos no desbordan la pila.
+ * Cada marco recuerda por qué vecino iba, de modo que el orden de visita es el mismo que
+ * el de la versión recursiva.
  * 
- * @param actual Nodo actual que se está explorando
- * @param destino Nodo objetivo de la búsqueda
- * @param visitado Vector que registra los nodos ya visitados
- * @param padre Vector que almacena el nodo padre de cada nodo para reconstruir el camino
- * @param generados Vector acumulativo de todos los nodos generados durante la búsqueda
- * @param inspeccionados Vector acumulativo de todos los nodos inspeccionados/expandidos
- * @param logs Vector donde se almacena el historial de cada iteración de la búsqueda
- * @return true Si se encontró un camino al nodo destino
- * @return false Si no se encontró camino desde el nodo actual
+ * Características:
+ * - Completo: En grafos finitos, encuentra solución si existe
+ * - No óptimo: Puede encontrar caminos más largos primero
+ * - Complejidad: O(V + E) en tiempo, O(V) en espacio (profundidad de la pila)
+ * - Eficiente en memoria para grafos con mucha profundidad
  * 
- * Esta función implementa el núcleo recursivo del DFS. Explora en profundidad cada rama
- * completamente antes de retroceder (backtracking). Cuando encuentra el destino, la
- * recursión se desenrolla y se reconstruye el camino mediante el vector de padres.
+ * @note Lo que se registra en SearchResult::logs depende de nivel_traza()
  */
-bool Grafo::DFSRecursivo(int actual, int destino, 
-                        std::vector<bool>& visitado, std::vector<int>& padre,
-                        std::vector<int>& generados, std::vector<int>& inspeccionados,
-                        std::vector<IterationLog>& logs) {
-  visitado[actual] = true;
-  // Registrar el nodo actual como inspeccionado si no lo está
-  if (std::find(inspeccionados.begin(), inspeccionados.end(), actual) == inspeccionados.end()) {
-      inspeccionados.push_back(actual);
-  }
-  // Guardar el estado actual de la búsqueda
-  logs.push_back({generados, inspeccionados});
-  // Caso base: se encontró el destino
-  if (actual == destino) {
-      return true;
-  }
-  // Explorar recursivamente todos los vecinos no visitados
-  for (int vecino : GetVecinos(actual)) {
-    if (!visitado[vecino]) {
-      // Registrar el vecino como generado si no lo está
-      if (std::find(generados.begin(), generados.end(), vecino) == generados.end()) {
-        generados.push_back(vecino);
-      }
-      padre[vecino] = actual;
-      // Llamada recursiva: explorar en profundidad esta rama
-      bool encontrado = DFSRecursivo(vecino, destino, visitado, padre, 
-                                       generados, inspeccionados, logs);
-      if (encontrado) {
-        return true;
-      }
-          // Si no se encontró en esta rama, continúa con el siguiente vecino
-          // (backtracking implícito en la recursión)
-      }
+SearchResult Grafo::DFS(int nodo_origen, int nodo_destino) const {
+  SearchWorkspace espacio;
+  return DFS(nodo_origen, nodo_destino, espacio);
+}
+
+/**
+ * @brief DFS reutilizando los buffers de un SearchWorkspace (ver DFS(int, int))
+ * 
+ * @param nodo_origen Índice del nodo de inicio de la búsqueda
+ * @param nodo_destino Índice del nodo objetivo a encontrar
+ * @param espacio Buffers de trabajo; tras la primera consulta no se reserva memoria para ellos
+ * @return SearchResult Estructura con el camino encontrado, costo e historial de búsqueda
+ */
+SearchResult Grafo::DFS(int nodo_origen, int nodo_destino, SearchWorkspace& espacio) const {
+  SearchResult r;
+  if (nodo_origen < 0 || nodo_origen >= numero_nodos_ ||
+      nodo_destino < 0 || nodo_destino >= numero_nodos_) {
+    return r;
+  }
+  const bool traza_vecinos = TrazarVecinos();
+  espacio.Preparar(numero_nodos_);
+  MarcasGeneracion& visitado = espacio.visitado;
+  MarcasGeneracion& generado = espacio.generado;
+  std::vector<int>& padre = espacio.padre;
+  std::vector<MarcoDFS>& pila = espacio.pila;
+  pila.clear();
+  pila.reserve(numero_nodos_);
+  r.logs = CrearLog();
+  // Estado inicial: nodo origen generado pero no inspeccionado
+  generado.Marcar(nodo_origen);
+  padre[nodo_origen] = -1;
+  r.logs.Generate(nodo_origen);
+  r.logs.EndIteration();
+  // Entrar en un nodo = marcarlo visitado, inspeccionarlo y cerrar una iteración
+  auto entrar = [&](int nodo) {
+    visitado.Marcar(nodo);
+    r.logs.Inspect(nodo);
+    r.logs.EndIteration();
+    pila.push_back({nodo, 0});
+    return nodo == nodo_destino;
+  };
+  bool encontrado = entrar(nodo_origen);
+  while (!encontrado && !pila.empty()) {
+    MarcoDFS& marco = pila.back();
+    const std::span<const int> vecinos = GetVecinos(marco.nodo);
+    // Rama agotada: retroceder al nodo anterior (backtracking)
+    if (marco.siguiente_vecino == vecinos.size()) {
+      pila.pop_back();
+      continue;
+    }
+    const int actual = marco.nodo;
+    const int vecino = vecinos[marco.siguiente_vecino++];
+    if (traza_vecinos) {
+      std::cerr << "  Vecino " << vecino + 1 << " de " << actual + 1 
+                << (visitado.Contiene(vecino) ? " (ya visitado)\n" : "\n");
+    }
+    if (visitado.Contiene(vecino)) continue;
+    // Registrar el vecino como generado si no lo está
+    if (!generado.Contiene(vecino)) {
+      generado.Marcar(vecino);
+      r.logs.Generate(vecino);
+    }
+    padre[vecino] = actual;
+    // Bajar un nivel: explorar en profundidad esta rama (invalida 'marco')
+    encontrado = entrar(vecino);
+  }
+  if (encontrado) {
+    // Reconstruir camino desde el destino hasta el origen
+    std::vector<int> path;
+    for (int v = nodo_destino; v != -1; v = padre[v]) {
+      path.push_back(v);
+    }
+    std::reverse(path.begin(), path.end());
+    r.path = path;
+    r.cost = CalcularCostoCamino(path);
   }
-  return false;
+  return r;
 }
 
 /**
- * @brief Implementa el algoritmo de Búsqueda en Profundidad (Depth-First Search)
+ * @brief Implementa la Búsqueda en Amplitud bidireccional
  * 
  * @param nodo_origen Índice del nodo de inicio de la búsqueda
  * @param nodo_destino Índice del nodo objetivo a encontrar
  * @return SearchResult Estructura con el camino encontrado, costo e historial de búsqueda
  * 
- * El algoritmo DFS explora el grafo en profundidad, siguiendo cada rama hasta su final
- * antes de retroceder y probar caminos alternativos. Utiliza recursión (pila de llamadas)
- * para gestionar el backtracking.
+ * Hace crecer dos fronteras BFS, una desde el origen y otra desde el destino, y en cada
+ * paso expande un nivel completo de la frontera más pequeña. Cuando un nodo queda
+ * alcanzado por ambos lados se ha encontrado un camino; se termina el nivel en curso y se
+ * elige el punto de encuentro que minimiza la suma de distancias, así que el camino
+ * tiene el mínimo número de aristas, igual que en BFS. En grafos anchos cada lado solo
+ * llega a la mitad de la profundidad, lo que reduce mucho los nodos explorados.
+ * 
+ * Una iteración del log es la expansión de un nodo de cualquiera de los dos lados. Los
+ * nodos generados son los descubiertos por primera vez por cualquiera de las fronteras.
  * 
  * Características:
- * - Completo: En grafos finitos, encuentra solución si existe
- * - No óptimo: Puede encontrar caminos más largos primero
- * - Complejidad: O(V + E) en tiempo, O(V) en espacio (profundidad de recursión)
- * - Eficiente en memoria para grafos con mucha profundidad
+ * - Completo: Siempre encuentra solución si existe
+ * - Óptimo: Encuentra el camino con menor número de aristas
+ * - Complejidad: O(V + E) en el peor caso, normalmente muy inferior a BFS
+ * 
+ * @note Lo que se registra en SearchResult::logs depende de nivel_traza()
+ * @note Supone un grafo no dirigido (la CSR es simétrica)
  */
-SearchResult Grafo::DFS(int nodo_origen, int nodo_destino) {
-    SearchResult r;
-    if (nodo_origen < 0 || nodo_origen >= numero_nodos_ ||
-        nodo_destino < 0 || nodo_destino >= numero_nodos_) {
-        return r;
-    }
-    std::vector<bool> visitado(numero_nodos_, false);
-    std::vector<int> padre(numero_nodos_, -1);
-    std::vector<int> generados;
-    std::vector<int> inspeccionados;
-    std::vector<IterationLog> logs;
-    // Estado inicial: nodo origen generado pero no inspeccionado
-    generados.push_back(nodo_origen);
-    logs.push_back({generados, inspeccionados});
-    // Iniciar búsqueda recursiva
-    bool encontrado = DFSRecursivo(nodo_origen, nodo_destino, visitado, padre,
-                                  generados, inspeccionados, logs);
-    r.logs = logs;
-    if (encontrado) {
-        // Reconstruir camino desde el destino hasta el origen
-        std::vector<int> path;
-        for (int v = nodo_destino; v != -1; v = padre[v]) {
-            path.push_back(v);
+SearchResult Grafo::BFSBidireccional(int nodo_origen, int nodo_destino) const {
+  SearchWorkspace espacio;
+  return BFSBidireccional(nodo_origen, nodo_destino, espacio);
+}
+
+/**
+ * @brief BFS bidireccional reutilizando los buffers de un SearchWorkspace
+ * 
+ * @param nodo_origen Índice del nodo de inicio de la búsqueda
+ * @param nodo_destino Índice del nodo objetivo a encontrar
+ * @param espacio Buffers de trabajo; tras la primera consulta no se reserva memoria para ellos
+ * @return SearchResult Estructura con el camino encontrado, costo e historial de búsqueda
+ */
+SearchResult Grafo::BFSBidireccional(int nodo_origen, int nodo_destino, SearchWorkspace& espacio) const {
+  SearchResult r;
+  if (nodo_origen < 0 || nodo_origen >= numero_nodos_ ||
+      nodo_destino < 0 || nodo_destino >= numero_nodos_) {
+    return r;
+  }
+  const bool traza_vecinos = TrazarVecinos();
+  espacio.Preparar(numero_nodos_);
+  // Nodos alcanzados, distancia y padre de cada nodo vistos desde cada extremo
+  // (distancia y padre solo son válidos para los nodos alcanzados por ese lado)
+  MarcasGeneracion& alcanzado_origen = espacio.visitado;
+  MarcasGeneracion& alcanzado_destino = espacio.visitado_destino;
+  std::vector<int>& distancia_origen = espacio.distancia;
+  std::vector<int>& distancia_destino = espacio.distancia_destino;
+  std::vector<int>& padre_origen = espacio.padre;
+  std::vector<int>& padre_destino = espacio.padre_destino;
+  std::vector<int>& frontera_origen = espacio.frontera;
+  std::vector<int>& frontera_destino = espacio.frontera_destino;
+  std::vector<int>& siguiente = espacio.cola;
+  frontera_origen.assign(1, nodo_origen);
+  frontera_destino.assign(1, nodo_destino);
+  r.logs = CrearLog();
+  // Estado inicial: ambos extremos generados pero no inspeccionados
+  alcanzado_origen.Marcar(nodo_origen);
+  distancia_origen[nodo_origen] = 0;
+  padre_origen[nodo_origen] = -1;
+  r.logs.Generate(nodo_origen);
+  alcanzado_destino.Marcar(nodo_destino);
+  distancia_destino[nodo_destino] = 0;
+  padre_destino[nodo_destino] = -1;
+  if (nodo_destino != nodo_origen) {
+    r.logs.Generate(nodo_destino);
+  }
+  r.logs.EndIteration();
+  int encuentro = (nodo_origen == nodo_destino) ? nodo_origen : -1;
+  int mejor_longitud = (encuentro == -1) ? std::numeric_limits<int>::max() : 0;
+  while (encuentro == -1 && !frontera_origen.empty() && !frontera_destino.empty()) {
+    // Expandir un nivel completo del lado con menos nodos en la frontera
+    const bool desde_origen = frontera_origen.size() <= frontera_destino.size();
+    std::vector<int>& frontera = desde_origen ? frontera_origen : frontera_destino;
+    std::vector<int>& distancia = desde_origen ? distancia_origen : distancia_destino;
+    std::vector<int>& padre = desde_origen ? padre_origen : padre_destino;
+    MarcasGeneracion& alcanzado = desde_origen ? alcanzado_origen : alcanzado_destino;
+    const MarcasGeneracion& alcanzado_otro = desde_origen ? alcanzado_destino : alcanzado_origen;
+    const std::vector<int>& distancia_otro = desde_origen ? distancia_destino : distancia_origen;
+    siguiente.clear();
+    for (const int u : frontera) {
+      r.logs.Inspect(u);
+      for (const int v : GetVecinos(u)) {
+        if (traza_vecinos) {
+          std::cerr << "  Vecino " << v + 1 << " de " << u + 1 
+                    << (desde_origen ? " (desde origen)" : " (desde destino)")
+                    << (alcanzado.Contiene(v) ? " (ya visitado)\n" : "\n");
+        }
+        if (alcanzado.Contiene(v)) continue;
+        alcanzado.Marcar(v);
+        distancia[v] = distancia[u] + 1;
+        padre[v] = u;
+        siguiente.push_back(v);
+        if (!alcanzado_otro.Contiene(v)) {
+          r.logs.Generate(v);
+        } else if (distancia[v] + distancia_otro[v] < mejor_longitud) {
+          // Las dos fronteras se tocan en 'v'
+          mejor_longitud = distancia[v] + distancia_otro[v];
+          encuentro = v;
         }
-        std::reverse(path.begin(), path.end());
-        r.path = path;
-        r.cost = CalcularCostoCamino(path);
+      }
+      r.logs.EndIteration();
+    }
+    frontera.swap(siguiente);
+  }
+  // Reconstrucción del camino: origen -> encuentro -> destino
+  if (encuentro != -1) {
+    std::vector<int> path;
+    for (int v = encuentro; v != -1; v = padre_origen[v]) {
+      path.push_back(v);
     }
+    std::reverse(path.begin(), path.end());
+    for (int v = padre_destino[encuentro]; v != -1; v = padre_destino[v]) {
+      path.push_back(v);
+    }
+    r.path = path;
+    r.cost = CalcularCostoCamino(path);
+  }
+  return r;
+}
+
+/**
+ * @brief Implementa la Búsqueda de Coste Uniforme (Dijkstra) sobre la CSR
+ * 
+ * @param nodo_origen Índice del nodo de inicio de la búsqueda
+ * @param nodo_destino Índice del nodo objetivo a encontrar
+ * @return SearchResult Estructura con el camino de coste mínimo, su costo e historial de búsqueda
+ * 
+ * Expande siempre el nodo abierto con menor coste acumulado g(n), usando un montículo
+ * binario (std::push_heap / std::pop_heap) con borrado perezoso: cuando se mejora el coste de un
+ * nodo se inserta una nueva entrada y las obsoletas se descartan al extraerlas. Los
+ * pesos se leen directamente de la fila CSR, alineados con los vecinos.
+ * 
+ * Una iteración del log es una extracción válida (inspección). Un nodo cuenta como
+ * generado la primera vez que se alcanza. A igualdad de coste se expande el de menor índice.
+ * 
+ * Características:
+ * - Completo: Siempre encuentra solución si existe
+ * - Óptimo: Encuentra el camino de menor coste (pesos no negativos)
+ * - Complejidad: O((V + E) log V) en tiempo, O(V + E) en espacio
+ * 
+ * @note Lo que se registra en SearchResult::logs depende de nivel_traza()
+ */
+SearchResult Grafo::UCS(int nodo_origen, int nodo_destino) const {
+  SearchWorkspace espacio;
+  return UCS(nodo_origen, nodo_destino, espacio);
+}
+
+/**
+ * @brief UCS reutilizando los buffers de un SearchWorkspace (ver UCS(int, int))
+ * 
+ * @param nodo_origen Índice del nodo de inicio de la búsqueda
+ * @param nodo_destino Índice del nodo objetivo a encontrar
+ * @param espacio Buffers de trabajo; tras la primera consulta no se reserva memoria para ellos
+ * @return SearchResult Estructura con el camino de coste mínimo, su costo e historial de búsqueda
+ */
+SearchResult Grafo::UCS(int nodo_origen, int nodo_destino, SearchWorkspace& espacio) const {
+  SearchResult r;
+  if (nodo_origen < 0 || nodo_origen >= numero_nodos_ ||
+      nodo_destino < 0 || nodo_destino >= numero_nodos_) {
     return r;
+  }
+  const bool traza_vecinos = TrazarVecinos();
+  espacio.Preparar(numero_nodos_);
+  // coste[v] y padre[v] solo son válidos para los nodos ya generados
+  std::vector<double>& coste = espacio.coste;
+  std::vector<int>& padre = espacio.padre;
+  MarcasGeneracion& cerrado = espacio.visitado;
+  MarcasGeneracion& generado = espacio.generado;
+  // Montículo de mínimos por (coste acumulado, nodo) sobre el vector del espacio de trabajo
+  std::vector<std::pair<double, int>>& abiertos = espacio.monticulo;
+  const std::greater<std::pair<double, int>> mayor;
+  abiertos.clear();
+  r.logs = CrearLog();
+  // Estado inicial: nodo origen generado pero no inspeccionado
+  generado.Marcar(nodo_origen);
+  coste[nodo_origen] = 0.0;
+  padre[nodo_origen] = -1;
+  abiertos.push_back({0.0, nodo_origen});
+  r.logs.Generate(nodo_origen);
+  r.logs.EndIteration();
+  while (!abiertos.empty()) {
+    std::pop_heap(abiertos.begin(), abiertos.end(), mayor);
+    const auto [coste_u, u] = abiertos.back();
+    abiertos.pop_back();
+    // Entrada obsoleta: el nodo ya se cerró con un coste menor
+    if (cerrado.Contiene(u)) continue;
+    cerrado.Marcar(u);
+    r.logs.Inspect(u);
+    if (u == nodo_destino) {
+      r.logs.EndIteration();
+      break;
+    }
+    const std::span<const int> vecinos = GetVecinos(u);
+    const std::span<const double> pesos = GetPesos(u);
+    for (size_t i = 0; i < vecinos.size(); ++i) {
+      const int v = vecinos[i];
+      const double nuevo_coste = coste_u + pesos[i];
+      if (traza_vecinos) {
+        std::cerr << "  Vecino " << v + 1 << " de " << u + 1 << " con coste " << nuevo_coste
+                  << (cerrado.Contiene(v) ? " (ya cerrado)\n" : "\n");
+      }
+      if (cerrado.Contiene(v)) continue;
+      if (!generado.Contiene(v)) {
+        generado.Marcar(v);
+        r.logs.Generate(v);
+      } else if (nuevo_coste >= coste[v]) {
+        continue;
+      }
+      coste[v] = nuevo_coste;
+      padre[v] = u;
+      abiertos.push_back({nuevo_coste, v});
+      std::push_heap(abiertos.begin(), abiertos.end(), mayor);
+    }
+    r.logs.EndIteration();
+  }
+  // Reconstrucción de camino y coste (si se llegó al destino)
+  if (cerrado.Contiene(nodo_destino)) {
+    std::vector<int> path;
+    for (int v = nodo_destino; v != -1; v = padre[v]) {
+      path.push_back(v);
+    }
+    std::reverse(path.begin(), path.end());
+    r.path = path;
+    r.cost = coste[nodo_destino];
+  }
+  return r;
+}
+
+// ============================================================================
+// CONSULTAS POR LOTES
+// ============================================================================
+
+/**
+ * @brief Resuelve una consulta con el algoritmo que indica
+ * 
+ * @param consulta Origen, destino y algoritmo
+ * @param espacio Buffers de trabajo reutilizables entre consultas
+ * @return SearchResult Resultado de la búsqueda
+ */
+SearchResult Grafo::Resolver(const ConsultaGrafo& consulta, SearchWorkspace& espacio) const {
+  switch (consulta.algoritmo) {
+    case AlgoritmoBusqueda::kDFS:
+      return DFS(consulta.origen, consulta.destino, espacio);
+    case AlgoritmoBusqueda::kUCS:
+      return UCS(consulta.origen, consulta.destino, espacio);
+    case AlgoritmoBusqueda::kBFSBidireccional:
+      return BFSBidireccional(consulta.origen, consulta.destino, espacio);
+    case AlgoritmoBusqueda::kBFS:
+    default:
+      return BFS(consulta.origen, consulta.destino, espacio);
+  }
+}
+
+/**
+ * @brief Resuelve muchas consultas sobre el grafo ya cargado repartiéndolas entre hilos
+ * 
+ * @param consultas Consultas a resolver
+ * @param hilos Número de hilos (0 = std::thread::hardware_concurrency())
+ * @return std::vector<SearchResult> Un resultado por consulta, en el mismo orden
+ * 
+ * Cada hilo toma la siguiente consulta pendiente con un contador atómico y usa su propio
+ * SearchWorkspace, así que los buffers de visitados, padres y colas se reservan una vez
+ * por hilo y no una vez por consulta. El grafo solo se lee.
+ */
+std::vector<SearchResult> Grafo::ResolverLote(const std::vector<ConsultaGrafo>& consultas,
+                                              unsigned hilos) const {
+  std::vector<SearchResult> resultados(consultas.size());
+  if (hilos == 0) {
+    hilos = std::max(1u, std::thread::hardware_concurrency());
+  }
+  hilos = static_cast<unsigned>(std::min<size_t>(hilos, std::max<size_t>(consultas.size(), 1)));
+  std::atomic<size_t> siguiente{0};
+  auto trabajar = [&]() {
+    SearchWorkspace espacio;
+    for (size_t i = siguiente.fetch_add(1, std::memory_order_relaxed); i < consultas.size();
+         i = siguiente.fetch_add(1, std::memory_order_relaxed)) {
+      resultados[i] = Resolver(consultas[i], espacio);
+    }
+  };
+  std::vector<std::thread> trabajadores;
+  trabajadores.reserve(hilos - 1);
+  for (unsigned id = 1; id < hilos; ++id) {
+    trabajadores.emplace_back(trabajar);
+  }
+  trabajar();
+  for (auto& trabajador : trabajadores) {
+    trabajador.join();
+  }
+  return resultados;
+}
+
+// ============================================================================
+// ÁRBOLES BFS COMPLETOS
+// ============================================================================
+
+// Umbrales de Beamer et al. para cambiar de sentido en el BFS por niveles:
+// top-down -> bottom-up cuando aristas(frontera) > aristas(no visitados) / kAlfa,
+// bottom-up -> top-down cuando nodos(frontera) < numero_nodos / kBeta
+static constexpr size_t kAlfa = 14;
+static constexpr size_t kBeta = 24;
+
+/**
+ * @brief BFS completo desde un origen que alterna expansión top-down y barridos bottom-up
+ * 
+ * @param nodo_origen Índice del nodo desde el que se calcula el árbol
+ * @return ArbolBFS Padres, niveles y nodos alcanzados por capas (vacío si el origen no es válido)
+ * 
+ * Es un BFS por niveles (level-synchronous) con la heurística de Beamer:
+ * - Top-down: cada nodo de la frontera recorre todos sus vecinos buscando no visitados.
+ * - Bottom-up: cada nodo no visitado busca un padre entre sus vecinos consultando un
+ *   mapa de bits de la frontera y se detiene en el primero que encuentra.
+ * Cuando la frontera es grande (típico a media búsqueda en grafos densos) el barrido
+ * bottom-up examina muchas menos aristas, porque la mayoría de nodos encuentran padre
+ * en los primeros vecinos. Con fronteras pequeñas se vuelve a top-down.
+ * 
+ * El árbol resultante es un árbol BFS válido (mismos niveles que BFS), aunque el padre
+ * elegido puede diferir del de BFS cuando hay varios candidatos del nivel anterior.
+ * 
+ * Complejidad: O(V + E) en el peor caso; aristas_examinadas indica el trabajo real
+ */
+ArbolBFS Grafo::ArbolBFSDireccionOptimizada(int nodo_origen) const {
+  ArbolBFS arbol;
+  if (nodo_origen < 0 || nodo_origen >= numero_nodos_) {
+    return arbol;
+  }
+  const size_t n = static_cast<size_t>(numero_nodos_);
+  arbol.padre.assign(n, -1);
+  arbol.nivel.assign(n, -1);
+  arbol.orden.reserve(n);
+  arbol.nivel[nodo_origen] = 0;
+  arbol.orden.push_back(nodo_origen);
+  arbol.inicio_nivel = {0, 1};
+  // Mapa de bits de la frontera para los pasos bottom-up
+  std::vector<uint64_t> en_frontera((n + 63) / 64, 0);
+  size_t aristas_no_visitadas = vecinos_.size() - (offsets_[nodo_origen + 1] - offsets_[nodo_origen]);
+  bool bottom_up = false;
+  for (int nivel = 0; ; ++nivel) {
+    const size_t inicio = arbol.inicio_nivel[nivel];
+    const size_t fin = arbol.inicio_nivel[nivel + 1];
+    const size_t nodos_frontera = fin - inicio;
+    if (nodos_frontera == 0) break;
+    size_t aristas_frontera = 0;
+    for (size_t i = inicio; i < fin; ++i) {
+      const int u = arbol.orden[i];
+      aristas_frontera += offsets_[u + 1] - offsets_[u];
+    }
+    // Decidir el sentido de este paso
+    if (!bottom_up && aristas_frontera > aristas_no_visitadas / kAlfa) {
+      bottom_up = true;
+    } else if (bottom_up && nodos_frontera < n / kBeta) {
+      bottom_up = false;
+    }
+    if (bottom_up) {
+      ++arbol.pasos_bottom_up;
+      std::fill(en_frontera.begin(), en_frontera.end(), 0);
+      for (size_t i = inicio; i < fin; ++i) {
+        const int u = arbol.orden[i];
+        en_frontera[u >> 6] |= uint64_t{1} << (u & 63);
+      }
+      for (size_t v = 0; v < n; ++v) {
+        if (arbol.nivel[v] != -1) continue;
+        for (const int u : GetVecinos(static_cast<int>(v))) {
+          ++arbol.aristas_examinadas;
+          if (en_frontera[u >> 6] & (uint64_t{1} << (u & 63))) {
+            arbol.padre[v] = u;
+            arbol.nivel[v] = nivel + 1;
+            arbol.orden.push_back(static_cast<int>(v));
+            break;
+          }
+        }
+      }
+    } else {
+      for (size_t i = inicio; i < fin; ++i) {
+        const int u = arbol.orden[i];
+        for (const int v : GetVecinos(u)) {
+          ++arbol.aristas_examinadas;
+          if (arbol.nivel[v] != -1) continue;
+          arbol.padre[v] = u;
+          arbol.nivel[v] = nivel + 1;
+          arbol.orden.push_back(v);
+        }
+      }
+    }
+    // Las aristas de los recién alcanzados dejan de contar como no visitadas
+    for (size_t i = fin; i < arbol.orden.size(); ++i) {
+      const int v = arbol.orden[i];
+      aristas_no_visitadas -= offsets_[v + 1] - offsets_[v];
+    }
+    arbol.inicio_nivel.push_back(arbol.orden.size());
+  }
+  // El último nivel registrado está vacío
+  arbol.inicio_nivel.pop_back();
+  return arbol;
+}
+
+// Nodos de la frontera que reparte cada vez un hilo del BFS paralelo
+static constexpr size_t kBloqueFrontera = 64;
+
+/**
+ * @brief BFS completo por niveles repartiendo cada frontera entre varios hilos
+ * 
+ * @param nodo_origen Índice del nodo desde el que se calcula el árbol
+ * @param hilos Número de hilos (0 = std::thread::hardware_concurrency())
+ * @return ArbolBFS Padres, niveles y nodos alcanzados por capas (vacío si el origen no es válido)
+ * 
+ * Los hilos se crean una sola vez y se sincronizan al final de cada nivel con una
+ * std::barrier. Dentro de un nivel cada hilo toma bloques de kBloqueFrontera nodos de
+ * la frontera con un contador atómico y reclama a los vecinos no visitados con un
+ * compare-and-swap sobre su padre, así cada nodo tiene un único padre aunque varios
+ * hilos lo alcancen a la vez. Los nodos reclamados van a un buffer propio del hilo, y
+ * la función de fin de fase de la barrera (que corre en un solo hilo) los concatena en
+ * la siguiente frontera.
+ * 
+ * El árbol es un árbol BFS válido (mismos niveles que BFS); el padre concreto de un
+ * nodo y el orden dentro de cada nivel pueden variar entre ejecuciones.
+ */
+ArbolBFS Grafo::ArbolBFSParalelo(int nodo_origen, unsigned hilos) const {
+  ArbolBFS arbol;
+  if (nodo_origen < 0 || nodo_origen >= numero_nodos_) {
+    return arbol;
+  }
+  if (hilos == 0) {
+    hilos = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const size_t n = static_cast<size_t>(numero_nodos_);
+  arbol.padre.assign(n, -1);
+  arbol.nivel.assign(n, -1);
+  arbol.orden.reserve(n);
+  // El origen es su propio padre durante la búsqueda para que cuente como visitado
+  arbol.padre[nodo_origen] = nodo_origen;
+  arbol.nivel[nodo_origen] = 0;
+  arbol.orden.push_back(nodo_origen);
+  arbol.inicio_nivel = {0, 1};
+  std::vector<std::vector<int>> siguientes(hilos);
+  std::vector<size_t> aristas_por_hilo(hilos, 0);
+  std::atomic<size_t> siguiente_bloque{0};
+  int nivel_actual = 0;
+  bool terminado = false;
+  // Fin de nivel: unir los buffers de los hilos en la nueva frontera
+  auto cerrar_nivel = [&]() noexcept {
+    for (auto& buffer : siguientes) {
+      arbol.orden.insert(arbol.orden.end(), buffer.begin(), buffer.end());
+      buffer.clear();
+    }
+    terminado = arbol.orden.size() == arbol.inicio_nivel.back();
+    if (!terminado) {
+      arbol.inicio_nivel.push_back(arbol.orden.size());
+    }
+    ++nivel_actual;
+    siguiente_bloque.store(0, std::memory_order_relaxed);
+  };
+  std::barrier sincronizacion(static_cast<std::ptrdiff_t>(hilos), cerrar_nivel);
+  auto trabajar = [&](unsigned id) {
+    std::vector<int>& mis_siguientes = siguientes[id];
+    size_t mis_aristas = 0;
+    while (!terminado) {
+      const size_t inicio = arbol.inicio_nivel[nivel_actual];
+      const size_t fin = arbol.inicio_nivel[nivel_actual + 1];
+      const int nivel_nuevo = nivel_actual + 1;
+      for (size_t bloque = inicio + siguiente_bloque.fetch_add(kBloqueFrontera, std::memory_order_relaxed);
+           bloque < fin;
+           bloque = inicio + siguiente_bloque.fetch_add(kBloqueFrontera, std::memory_order_relaxed)) {
+        const size_t fin_bloque = std::min(bloque + kBloqueFrontera, fin);
+        for (size_t i = bloque; i < fin_bloque; ++i) {
+          const int u = arbol.orden[i];
+          for (const int v : GetVecinos(u)) {
+            ++mis_aristas;
+            std::atomic_ref<int> padre_v{arbol.padre[v]};
+            int libre = -1;
+            if (padre_v.load(std::memory_order_relaxed) != -1) continue;
+            if (padre_v.compare_exchange_strong(libre, u, std::memory_order_relaxed)) {
+              arbol.nivel[v] = nivel_nuevo;
+              mis_siguientes.push_back(v);
+            }
+          }
+        }
+      }
+      sincronizacion.arrive_and_wait();
+    }
+    aristas_por_hilo[id] = mis_aristas;
+  };
+  std::vector<std::thread> trabajadores;
+  trabajadores.reserve(hilos - 1);
+  for (unsigned id = 1; id < hilos; ++id) {
+    trabajadores.emplace_back(trabajar, id);
+  }
+  trabajar(0);
+  for (auto& trabajador : trabajadores) {
+    trabajador.join();
+  }
+  arbol.padre[nodo_origen] = -1;
+  for (const size_t aristas : aristas_por_hilo) {
+    arbol.aristas_examinadas += aristas;
+  }
+  return arbol;
+}
+
+/**
+ * @brief Convierte un árbol BFS en el SearchResult de una consulta origen-destino
+ * 
+ * @param arbol Árbol calculado desde el origen de la consulta
+ * @param nodo_destino Índice del nodo destino
+ * @return SearchResult Camino por el árbol, su costo y un log con una iteración por nivel
+ * 
+ * En cada iteración del log se inspeccionan todos los nodos de un nivel y se generan los
+ * del siguiente, hasta el nivel del destino (o todos si el destino no es alcanzable).
+ */
+SearchResult Grafo::ResultadoDesdeArbol(const ArbolBFS& arbol, int nodo_destino) const {
+  SearchResult r;
+  if (arbol.orden.empty() || nodo_destino < 0 || nodo_destino >= numero_nodos_) {
+    return r;
+  }
+  r.logs = CrearLog();
+  const int nivel_destino = arbol.nivel[nodo_destino];
+  const size_t ultimo_nivel = (nivel_destino == -1) ? arbol.niveles() - 1 : static_cast<size_t>(nivel_destino);
+  r.logs.Generate(arbol.orden.front());
+  r.logs.EndIteration();
+  for (size_t k = 0; k <= ultimo_nivel; ++k) {
+    for (size_t i = arbol.inicio_nivel[k]; i < arbol.inicio_nivel[k + 1]; ++i) {
+      r.logs.Inspect(arbol.orden[i]);
+    }
+    if (k < ultimo_nivel) {
+      for (size_t i = arbol.inicio_nivel[k + 1]; i < arbol.inicio_nivel[k + 2]; ++i) {
+        r.logs.Generate(arbol.orden[i]);
+      }
+    }
+    r.logs.EndIteration();
+  }
+  if (nivel_destino != -1) {
+    std::vector<int> path;
+    for (int v = nodo_destino; v != -1; v = arbol.padre[v]) {
+      path.push_back(v);
+    }
+    std::reverse(path.begin(), path.end());
+    r.path = path;
+    r.cost = CalcularCostoCamino(path);
+  }
+  return r;
+}
+
+// ============================================================================
+// CAMINOS MÍNIMOS ENTRE TODOS LOS PARES
+// ============================================================================
+
+/**
+ * @brief Calcula la tabla de distancias mínimas y siguientes saltos entre todos los pares
+ * 
+ * @param hilos Número de hilos (0 = std::thread::hardware_concurrency())
+ * @return TablaCaminos Tabla lista para consultar o guardar
+ * @throw std::runtime_error Si el grafo tiene más de TablaCaminos::kMaxNodos nodos
+ * 
+ * Lanza un Dijkstra completo desde cada nodo, repartiendo las raíces entre hilos con un
+ * contador atómico como ResolverLote. Cada hilo escribe filas distintas de la tabla y usa
+ * su propio SearchWorkspace. Coste O(V (V + E) log V) en tiempo y 12 V^2 bytes de tabla.
+ * 
+ * @note Supone un grafo no dirigido (la CSR es simétrica): el árbol de caminos mínimos
+ *       con raíz en d da, para cada origen, el siguiente salto hacia d.
+ */
+TablaCaminos Grafo::CalcularTablaCaminos(unsigned hilos) const {
+  TablaCaminos tabla;
+  tabla.Reservar(numero_nodos_);
+  if (hilos == 0) {
+    hilos = std::max(1u, std::thread::hardware_concurrency());
+  }
+  hilos = static_cast<unsigned>(std::min<size_t>(hilos, std::max(numero_nodos_, 1)));
+  std::atomic<int> siguiente{0};
+  auto trabajar = [&]() {
+    SearchWorkspace espacio;
+    for (int raiz = siguiente.fetch_add(1, std::memory_order_relaxed); raiz < numero_nodos_;
+         raiz = siguiente.fetch_add(1, std::memory_order_relaxed)) {
+      ArbolCostesMinimos(raiz, espacio, tabla.FilaDistancias(raiz), tabla.FilaSiguientes(raiz));
+    }
+  };
+  std::vector<std::thread> trabajadores;
+  trabajadores.reserve(hilos - 1);
+  for (unsigned id = 1; id < hilos; ++id) {
+    trabajadores.emplace_back(trabajar);
+  }
+  trabajar();
+  for (auto& trabajador : trabajadores) {
+    trabajador.join();
+  }
+  return tabla;
+}
+
+/**
+ * @brief Dijkstra completo desde una raíz, sin log, escribiendo una fila de TablaCaminos
+ * 
+ * @param raiz Nodo raíz del árbol de caminos mínimos
+ * @param espacio Buffers de trabajo (se usan las marcas de cerrados y el montículo)
+ * @param distancia Fila de distancias a rellenar (llega a infinito)
+ * @param padre Fila de padres en el árbol a rellenar (llega a -1)
+ * 
+ * Mismo orden de expansión y desempate que UCS, de modo que los caminos coinciden con
+ * los que devuelve UCS desde la raíz.
+ */
+void Grafo::ArbolCostesMinimos(int raiz, SearchWorkspace& espacio, std::span<double> distancia,
+                               std::span<int> padre) const {
+  espacio.Preparar(numero_nodos_);
+  MarcasGeneracion& cerrado = espacio.visitado;
+  std::vector<std::pair<double, int>>& abiertos = espacio.monticulo;
+  const std::greater<std::pair<double, int>> mayor;
+  abiertos.clear();
+  distancia[raiz] = 0.0;
+  abiertos.push_back({0.0, raiz});
+  while (!abiertos.empty()) {
+    std::pop_heap(abiertos.begin(), abiertos.end(), mayor);
+    const auto [coste_u, u] = abiertos.back();
+    abiertos.pop_back();
+    if (cerrado.Contiene(u)) continue;
+    cerrado.Marcar(u);
+    const std::span<const int> vecinos = GetVecinos(u);
+    const std::span<const double> pesos = GetPesos(u);
+    for (size_t i = 0; i < vecinos.size(); ++i) {
+      const int v = vecinos[i];
+      const double nuevo_coste = coste_u + pesos[i];
+      if (cerrado.Contiene(v) || nuevo_coste >= distancia[v]) continue;
+      distancia[v] = nuevo_coste;
+      padre[v] = u;
+      abiertos.push_back({nuevo_coste, v});
+      std::push_heap(abiertos.begin(), abiertos.end(), mayor);
+    }
+  }
 }
 
 // ============================================================================
@@ -19,56 +19,231 @@
 #include <vector>
 #include <fstream>
 #include <iomanip> // Para std::setprecision y std::setw
-#include <queue> // Cola para el BFS 
-#include <stack> // Pila para el DFS
 #include <unordered_map> // Para std::unordered_map
+#include <span> // Vista de los vecinos de un nodo en la CSR
+#include <memory> // std::unique_ptr
+#include <utility> // std::pair
+#include <algorithm> // std::fill
+#include <cstdint> // uint32_t
+#include <limits> // std::numeric_limits
+#include "fichero_mapeado.h"
+#include "tabla_caminos.h"
 
-// Logs de la busqueda
+// Nivel de traza de las busquedas. Cada nivel incluye a los anteriores:
+//  - kNinguno: solo el camino y su coste
+//  - kResumen: ademas, contadores de iteraciones y nodos generados/inspeccionados
+//  - kIteracion: ademas, los nodos generados/inspeccionados de cada iteracion
+//  - kVecino: ademas, cada vecino examinado se escribe en std::cerr
+enum class NivelTraza { kNinguno, kResumen, kIteracion, kVecino };
+
+// Vista de una iteración de la busqueda (prefijos de los nodos acumulados)
 struct IterationLog {
-  std::vector<int> generated_accumulated{};     
-  std::vector<int> inspected_accumulated{};  
+  std::span<const int> generated_accumulated{};     
+  std::span<const int> inspected_accumulated{};  
+};
+
+// Logs de la busqueda codificados por deltas: cada nodo se guarda una sola vez
+// en el orden en que se generó / inspeccionó y cada iteración solo recuerda
+// hasta dónde llegaban ambas secuencias. Memoria O(V + iteraciones).
+// Con record == false solo se cuentan los nodos y las iteraciones, sin reservar memoria.
+struct SearchLog {
+  bool record{true};
+  size_t iterations{};
+  size_t generated_count{};
+  size_t inspected_count{};
+  std::vector<int> generated{};
+  std::vector<int> inspected{};
+  std::vector<size_t> generated_end{};
+  std::vector<size_t> inspected_end{};
+  // Registro durante la búsqueda
+  void Generate(int nodo) {
+    ++generated_count;
+    if (record) generated.push_back(nodo);
+  }
+  void Inspect(int nodo) {
+    ++inspected_count;
+    if (record) inspected.push_back(nodo);
+  }
+  void EndIteration() {
+    ++iterations;
+    if (!record) return;
+    generated_end.push_back(generated.size());
+    inspected_end.push_back(inspected.size());
+  }
+  // Acceso a la vista acumulada de la iteración i (se reconstruye al consultarla)
+  // size() es el numero de iteraciones registradas (0 si record == false)
+  size_t size() const noexcept { return generated_end.size(); }
+  IterationLog operator[](size_t i) const {
+    return {std::span<const int>{generated}.first(generated_end[i]),
+            std::span<const int>{inspected}.first(inspected_end[i])};
+  }
 };
 
 // Resultado de una búsqueda en el grafo
 struct SearchResult {
   std::vector<int> path{};          
   double cost = 0.0;              
-  std::vector<IterationLog> logs{}; 
+  SearchLog logs{}; 
+};
+
+// Marco de la pila explícita del DFS: nodo en curso y siguiente vecino por explorar
+struct MarcoDFS {
+  int nodo;
+  size_t siguiente_vecino;
+};
+
+// Conjunto de nodos marcados en la consulta actual. Cada nodo guarda la generación en la
+// que se marcó por última vez, así que vaciar el conjunto es avanzar la generación (O(1))
+// en lugar de volver a poner a cero un array de tamaño V.
+class MarcasGeneracion {
+ public:
+  // Vacía el conjunto y garantiza espacio para 'n' nodos
+  void Reiniciar(size_t n) {
+    if (sello_.size() < n) sello_.resize(n, 0);
+    if (generacion_ == std::numeric_limits<uint32_t>::max()) {
+      std::fill(sello_.begin(), sello_.end(), 0);
+      generacion_ = 0;
+    }
+    ++generacion_;
+  }
+  bool Contiene(size_t nodo) const noexcept { return sello_[nodo] == generacion_; }
+  void Marcar(size_t nodo) noexcept { sello_[nodo] = generacion_; }
+
+ private:
+  std::vector<uint32_t> sello_{};
+  uint32_t generacion_{0};
+};
+
+// Buffers de trabajo de las busquedas. Reutilizar el mismo SearchWorkspace entre
+// consultas evita reservar memoria en cada una; no debe compartirse entre hilos.
+// Los arrays por nodo (padre, distancia, coste) no se reinician: solo son válidos
+// para los nodos marcados en la consulta en curso, de modo que una consulta solo
+// toca los nodos que alcanza.
+struct SearchWorkspace {
+  MarcasGeneracion visitado{};
+  MarcasGeneracion generado{};
+  MarcasGeneracion visitado_destino{};
+  std::vector<int> padre{};
+  std::vector<int> padre_destino{};
+  std::vector<int> distancia{};
+  std::vector<int> distancia_destino{};
+  std::vector<double> coste{};
+  std::vector<int> cola{};
+  std::vector<int> frontera{};
+  std::vector<int> frontera_destino{};
+  std::vector<MarcoDFS> pila{};
+  std::vector<std::pair<double, int>> monticulo{};
+  // Prepara los buffers para un grafo de 'n' nodos (solo reserva si crece)
+  void Preparar(size_t n) {
+    visitado.Reiniciar(n);
+    generado.Reiniciar(n);
+    visitado_destino.Reiniciar(n);
+    if (padre.size() < n) {
+      padre.resize(n);
+      padre_destino.resize(n);
+      distancia.resize(n);
+      distancia_destino.resize(n);
+      coste.resize(n);
+    }
+  }
+};
+
+// Algoritmos que se pueden pedir en una consulta por lotes
+enum class AlgoritmoBusqueda { kBFS, kDFS, kUCS, kBFSBidireccional };
+
+// Consulta origen-destino (índices base 0) para Grafo::ResolverLote
+struct ConsultaGrafo {
+  int origen = 0;
+  int destino = 0;
+  AlgoritmoBusqueda algoritmo = AlgoritmoBusqueda::kBFS;
+};
+
+// Árbol BFS completo desde un origen (alcanzabilidad y capas de distancia)
+struct ArbolBFS {
+  std::vector<int> padre{};          // -1 en el origen y en los no alcanzados
+  std::vector<int> nivel{};          // distancia en aristas, -1 si no alcanzado
+  std::vector<int> orden{};          // nodos alcanzados agrupados por nivel
+  std::vector<size_t> inicio_nivel{}; // el nivel k es orden[inicio_nivel[k] .. inicio_nivel[k + 1])
+  size_t aristas_examinadas = 0;
+  size_t pasos_bottom_up = 0;
+  size_t niveles() const noexcept { return inicio_nivel.empty() ? 0 : inicio_nivel.size() - 1; }
 };
 
 /**
  * Clase Grafo
- *       Trabaja con un grafo en el cual podemos hacer busquedas BFS y DFS
+ *       Trabaja con un grafo en el cual podemos hacer busquedas BFS, DFS y de coste uniforme (UCS)
+ *
+ * Las aristas se guardan en formato CSR (compressed sparse row), por lo que
+ * la memoria y el coste de recorrer los vecinos son O(V + E). La matriz de
+ * adyacencia densa solo se construye bajo demanda para grafos pequeños.
  */
 class Grafo {
  public:
   // Constructores
   Grafo() = default;
-  explicit Grafo(const std::string& grafo) { ProcesarGrafo(grafo); }
+  explicit Grafo(const std::string& grafo, bool matriz_densa = false) 
+      : usar_matriz_densa_{matriz_densa} { ProcesarGrafo(grafo); }
   // Google Style getters
   int numero_nodos() const noexcept { return numero_nodos_; }
   int numero_aristas() const noexcept { return numero_aristas_; } 
+  bool matriz_densa() const noexcept { return usar_matriz_densa_; }
+  double tiempo_carga_ms() const noexcept { return tiempo_carga_ms_; }
+  NivelTraza nivel_traza() const noexcept { return nivel_traza_; }
+  // Setters
+  void set_nivel_traza(NivelTraza nivel) noexcept { nivel_traza_ = nivel; }
   // Metodos de utiidad y debug
   void ProcesarGrafo(const std::string&);
+  void GuardarInstantanea(const std::string&) const;
   void ImprimirMatriz() const;
   // Metodos de busqueda
-  SearchResult BFS(int nodo_origen, int nodo_destino);
-  SearchResult DFS(int nodo_origen, int nodo_destino);
+  SearchResult BFS(int nodo_origen, int nodo_destino) const;
+  SearchResult BFS(int nodo_origen, int nodo_destino, SearchWorkspace&) const;
+  SearchResult DFS(int nodo_origen, int nodo_destino) const;
+  SearchResult DFS(int nodo_origen, int nodo_destino, SearchWorkspace&) const;
+  SearchResult BFSBidireccional(int nodo_origen, int nodo_destino) const;
+  SearchResult BFSBidireccional(int nodo_origen, int nodo_destino, SearchWorkspace&) const;
+  SearchResult UCS(int nodo_origen, int nodo_destino) const;
+  SearchResult UCS(int nodo_origen, int nodo_destino, SearchWorkspace&) const;
+  SearchResult Resolver(const ConsultaGrafo&, SearchWorkspace&) const;
+  std::vector<SearchResult> ResolverLote(const std::vector<ConsultaGrafo>&, unsigned hilos) const;
+  ArbolBFS ArbolBFSDireccionOptimizada(int nodo_origen) const;
+  ArbolBFS ArbolBFSParalelo(int nodo_origen, unsigned hilos) const;
+  SearchResult ResultadoDesdeArbol(const ArbolBFS&, int nodo_destino) const;
+  TablaCaminos CalcularTablaCaminos(unsigned hilos) const;
 
  private:
   int numero_nodos_{};
   int numero_aristas_{};
+  bool usar_matriz_densa_{false};
+  double tiempo_carga_ms_{};
+  NivelTraza nivel_traza_{NivelTraza::kIteracion};
+  // CSR: los vecinos del nodo i son vecinos_[offsets_[i]] .. vecinos_[offsets_[i + 1] - 1]
+  // (ordenados de menor a mayor) y pesos_ guarda el peso de cada una de esas aristas.
+  // Son vistas sobre los almacen_* (carga desde texto) o sobre la instantánea proyectada
+  std::span<const size_t> offsets_{};
+  std::span<const int> vecinos_{};
+  std::span<const double> pesos_{};
+  std::vector<size_t> almacen_offsets_{};
+  std::vector<int> almacen_vecinos_{};
+  std::vector<double> almacen_pesos_{};
+  std::unique_ptr<FicheroMapeado> instantanea_{};
+  // Matriz de adyacencia densa, solo si se pidió en el constructor
   std::vector<std::vector<double>> matriz_adyacencia_{};
   // Metodos auxiliares
-  std::vector<int> GetVecinos(int) const;
+  SearchLog CrearLog() const { return SearchLog{nivel_traza_ >= NivelTraza::kIteracion}; }
+  bool TrazarVecinos() const noexcept { return nivel_traza_ == NivelTraza::kVecino; }
+  std::span<const int> GetVecinos(int) const;
+  std::span<const double> GetPesos(int) const;
   bool ExisteArista(int, int) const;
   double GetPeso(int, int) const;
+  size_t BuscarArista(int, int) const;
+  void ConstruirCSR(const std::vector<int>&, const std::vector<int>&,
+                    const std::vector<double>&, const std::vector<size_t>&);
+  void ArbolCostesMinimos(int raiz, SearchWorkspace&, std::span<double>, std::span<int>) const;
+  static bool EsInstantanea(const FicheroMapeado&);
+  void CargarInstantanea(std::unique_ptr<FicheroMapeado>);
   std::vector<int> ReconstruirCamino(const std::unordered_map<int, int>& parent, int start, int goal) const;
   double CalcularCostoCamino(const std::vector<int>& path) const;
-  // DFS auxiliar
-  bool DFSRecursivo(int actual, int destino, std::vector<bool>& visitado, std::vector<int>& padre,
-                    std::vector<int>& generados, std::vector<int>& inspeccionados,
-                    std::vector<IterationLog>& logs);
 
 };
 
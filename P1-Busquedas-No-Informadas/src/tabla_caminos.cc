@@ -0,0 +1,215 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 1: Busquedas no informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date Sep 01 2025
+  * @brief Definicion de los metodos de la clase TablaCaminos
+  * @version 1.0
+  */
+
+#include "tabla_caminos.h"
+#include <fstream>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <chrono> // Tiempo de carga
+#include <cstring> // std::memcmp, std::memcpy
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+/**
+ * Cabecera del fichero de una TablaCaminos (versión 1, little-endian)
+ *
+ * Tras la cabecera van:
+ * - distancias: numero_nodos x numero_nodos x double (por filas de destino)
+ * - siguientes: numero_nodos x numero_nodos x int32 (por filas de destino)
+ */
+struct CabeceraTablaCaminos {
+  char magia[8];
+  uint32_t version;
+  uint32_t orden_bytes;
+  uint64_t numero_nodos;
+};
+
+static constexpr char kMagiaTabla[8] = {'I', 'A', 'T', 'A', 'B', 'L', 'A', '\0'};
+static constexpr uint32_t kVersionTablaCaminos = 1;
+static constexpr uint32_t kOrdenBytes = 0x01020304;
+static_assert(sizeof(int) == sizeof(int32_t), "La tabla asume int de 32 bits");
+static_assert(sizeof(CabeceraTablaCaminos) % sizeof(double) == 0, "Las distancias deben quedar alineadas");
+
+/**
+ * @brief Reserva una tabla vacía para un grafo de numero_nodos nodos
+ *
+ * @param numero_nodos Número de nodos del grafo
+ * @throw std::runtime_error Si el grafo supera kMaxNodos
+ *
+ * Todas las distancias quedan a infinito y todos los siguientes saltos a -1. Las filas
+ * se rellenan después con FilaDistancias y FilaSiguientes.
+ */
+void TablaCaminos::Reservar(int numero_nodos) {
+  if (numero_nodos < 0 || numero_nodos > kMaxNodos) {
+    throw std::runtime_error("La tabla de caminos admite como máximo " + std::to_string(kMaxNodos) +
+                             " nodos (el grafo tiene " + std::to_string(numero_nodos) + ")");
+  }
+  const size_t celdas = static_cast<size_t>(numero_nodos) * numero_nodos;
+  numero_nodos_ = numero_nodos;
+  fichero_.reset();
+  almacen_distancias_.assign(celdas, std::numeric_limits<double>::infinity());
+  almacen_siguientes_.assign(celdas, -1);
+  distancias_ = almacen_distancias_;
+  siguientes_ = almacen_siguientes_;
+}
+
+/**
+ * @brief Fila de distancias hacia un destino, para rellenarla
+ *
+ * @param destino Nodo destino de la fila
+ * @return std::span<double> Distancia de cada origen al destino
+ * @note Solo es válido sobre una tabla creada con Reservar (no sobre una cargada)
+ */
+std::span<double> TablaCaminos::FilaDistancias(int destino) {
+  return std::span<double>{almacen_distancias_}.subspan(Indice(0, destino), numero_nodos_);
+}
+
+/**
+ * @brief Fila de siguientes saltos hacia un destino, para rellenarla
+ *
+ * @param destino Nodo destino de la fila
+ * @return std::span<int> Vecino por el que sigue cada origen hacia el destino
+ * @note Solo es válido sobre una tabla creada con Reservar (no sobre una cargada)
+ */
+std::span<int> TablaCaminos::FilaSiguientes(int destino) {
+  return std::span<int>{almacen_siguientes_}.subspan(Indice(0, destino), numero_nodos_);
+}
+
+/**
+ * @brief Reconstruye el camino mínimo entre dos nodos siguiendo los saltos de la tabla
+ *
+ * @param origen Índice del nodo de inicio
+ * @param destino Índice del nodo objetivo
+ * @return std::vector<int> Nodos del camino de origen a destino (vacío si no hay camino)
+ * @throw std::runtime_error Si los saltos forman un ciclo (tabla corrupta)
+ *
+ * Solo lee la fila del destino, así que el coste es O(longitud del camino).
+ */
+std::vector<int> TablaCaminos::Camino(int origen, int destino) const {
+  std::vector<int> camino;
+  if (origen < 0 || origen >= numero_nodos_ || destino < 0 || destino >= numero_nodos_ ||
+      distancia(origen, destino) == std::numeric_limits<double>::infinity()) {
+    return camino;
+  }
+  for (int v = origen; v != -1; v = siguiente_salto(v, destino)) {
+    // Un camino simple tiene como mucho n nodos; más solo es posible si hay un ciclo
+    if (camino.size() == static_cast<size_t>(numero_nodos_)) {
+      throw std::runtime_error("Tabla de caminos corrupta: los saltos hacia " + std::to_string(destino) +
+                               " forman un ciclo");
+    }
+    camino.push_back(v);
+  }
+  return camino;
+}
+
+/**
+ * @brief Guarda la tabla en un fichero binario
+ *
+ * @param nombre Ruta del fichero a crear
+ * @throw std::runtime_error Si el fichero no se puede escribir
+ */
+void TablaCaminos::Guardar(const std::string& nombre) const {
+  std::ofstream fichero{nombre, std::ios::binary};
+  if (!fichero.is_open()) {
+    throw std::runtime_error("No se pudo crear el fichero: " + nombre);
+  }
+  CabeceraTablaCaminos cabecera{};
+  std::memcpy(cabecera.magia, kMagiaTabla, sizeof(kMagiaTabla));
+  cabecera.version = kVersionTablaCaminos;
+  cabecera.orden_bytes = kOrdenBytes;
+  cabecera.numero_nodos = static_cast<uint64_t>(numero_nodos_);
+  fichero.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+  fichero.write(reinterpret_cast<const char*>(distancias_.data()), distancias_.size_bytes());
+  fichero.write(reinterpret_cast<const char*>(siguientes_.data()), siguientes_.size_bytes());
+  if (!fichero) {
+    throw std::runtime_error("Error al escribir el fichero: " + nombre);
+  }
+}
+
+/**
+ * @brief Comprueba que cada siguiente salto sea un nodo y concuerde con su distancia
+ *
+ * @param numero_nodos Número de nodos de la tabla
+ * @param distancias Distancias por filas de destino
+ * @param siguientes Siguientes saltos por filas de destino
+ * @throw std::runtime_error Si algún salto está fuera de [-1, n) o no concuerda con la distancia
+ *
+ * Un salto es -1 exactamente cuando el origen es el destino o el destino es inalcanzable
+ * (distancia infinita); en cualquier otro caso debe ser un nodo del grafo.
+ */
+static void ValidarSaltos(int numero_nodos, std::span<const double> distancias, std::span<const int> siguientes) {
+  for (int destino = 0; destino < numero_nodos; ++destino) {
+    for (int origen = 0; origen < numero_nodos; ++origen) {
+      const size_t indice = static_cast<size_t>(destino) * numero_nodos + origen;
+      const int salto = siguientes[indice];
+      const bool inalcanzable = distancias[indice] == std::numeric_limits<double>::infinity();
+      const bool sin_salto = origen == destino || inalcanzable;
+      if (salto < -1 || salto >= numero_nodos || (salto == -1) != sin_salto) {
+        throw std::runtime_error("Tabla de caminos con un siguiente salto incoherente: " + std::to_string(salto) +
+                                 " (origen " + std::to_string(origen) + ", destino " + std::to_string(destino) + ")");
+      }
+    }
+  }
+}
+
+/**
+ * @brief Carga una tabla guardada con Guardar proyectándola en memoria
+ *
+ * @param nombre Ruta del fichero de la tabla
+ * @throw std::runtime_error Si el fichero no es una tabla o sus tamaños no son coherentes
+ *
+ * Las tablas apuntan directamente a la proyección, así que la carga no copia datos.
+ * Cada siguiente salto se valida una vez al cargar (Camino lo sigue sin comprobar
+ * límites), así que la carga recorre la tabla entera. El tiempo queda en tiempo_carga_ms().
+ * Si la tabla no es válida se lanza la excepción sin modificar la tabla actual.
+ */
+void TablaCaminos::Cargar(const std::string& nombre) {
+  const auto inicio_carga = std::chrono::steady_clock::now();
+  auto fichero = std::make_unique<FicheroMapeado>(nombre);
+  CabeceraTablaCaminos cabecera{};
+  if (fichero->size() < sizeof(cabecera) ||
+      std::memcmp(fichero->data(), kMagiaTabla, sizeof(kMagiaTabla)) != 0) {
+    throw std::runtime_error("El fichero no es una tabla de caminos: " + nombre);
+  }
+  std::memcpy(&cabecera, fichero->data(), sizeof(cabecera));
+  if (cabecera.version != kVersionTablaCaminos) {
+    throw std::runtime_error("Versión de tabla de caminos no soportada: " + std::to_string(cabecera.version));
+  }
+  if (cabecera.orden_bytes != kOrdenBytes) {
+    throw std::runtime_error("Tabla de caminos creada con otro orden de bytes");
+  }
+  if (cabecera.numero_nodos > static_cast<uint64_t>(kMaxNodos)) {
+    throw std::runtime_error("Tabla de caminos con tamaño incoherente");
+  }
+  const size_t celdas = cabecera.numero_nodos * cabecera.numero_nodos;
+  const size_t bytes_distancias = celdas * sizeof(double);
+  if (fichero->size() != sizeof(cabecera) + bytes_distancias + celdas * sizeof(int32_t)) {
+    throw std::runtime_error("Tabla de caminos con tamaño incoherente");
+  }
+  const char* datos = fichero->data() + sizeof(cabecera);
+  const int numero_nodos = static_cast<int>(cabecera.numero_nodos);
+  const std::span<const double> distancias{reinterpret_cast<const double*>(datos), celdas};
+  const std::span<const int> siguientes{reinterpret_cast<const int*>(datos + bytes_distancias), celdas};
+  ValidarSaltos(numero_nodos, distancias, siguientes);
+  numero_nodos_ = numero_nodos;
+  distancias_ = distancias;
+  siguientes_ = siguientes;
+  almacen_distancias_.clear();
+  almacen_siguientes_.clear();
+  fichero_ = std::move(fichero);
+  tiempo_carga_ms_ = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - inicio_carga).count();
+}
@@ -0,0 +1,72 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 1: Busquedas no informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date Sep 01 2025
+  * @brief Declaracion de la clase TablaCaminos (caminos mínimos entre todos los pares)
+  * @version 1.0
+  */
+
+#ifndef TABLA_CAMINOS_H
+#define TABLA_CAMINOS_H
+
+#include <string>
+#include <vector>
+#include <span>
+#include <memory> // std::unique_ptr
+#include "fichero_mapeado.h"
+
+/**
+ * Clase TablaCaminos
+ *       Distancia mínima y siguiente salto entre todos los pares de nodos de un grafo
+ *       no dirigido, para responder consultas origen-destino sin volver a buscar.
+ *
+ * Las dos tablas son arrays planos n x n organizados por filas de destino: la fila d
+ * guarda, para cada origen o, la distancia de o a d y el vecino de o por el que sigue
+ * el camino mínimo hacia d (-1 si o == d o si d no es alcanzable). Así cada fila es el
+ * árbol de caminos mínimos con raíz en d y un camino se reconstruye leyendo una sola fila.
+ *
+ * La tabla se calcula con Grafo::CalcularTablaCaminos, se guarda en un fichero binario y
+ * al cargarla se proyecta en memoria (mmap) sin copiar, igual que las instantáneas de Grafo.
+ */
+class TablaCaminos {
+ public:
+  // Máximo de nodos admitido: la tabla ocupa 12 * n * n bytes
+  static constexpr int kMaxNodos = 16384;
+  // Constructores
+  TablaCaminos() = default;
+  explicit TablaCaminos(const std::string& fichero) { Cargar(fichero); }
+  // Google Style getters
+  int numero_nodos() const noexcept { return numero_nodos_; }
+  double tiempo_carga_ms() const noexcept { return tiempo_carga_ms_; }
+  double distancia(int origen, int destino) const { return distancias_[Indice(origen, destino)]; }
+  int siguiente_salto(int origen, int destino) const { return siguientes_[Indice(origen, destino)]; }
+  // Metodos de utilidad
+  void Reservar(int numero_nodos);
+  std::span<double> FilaDistancias(int destino);
+  std::span<int> FilaSiguientes(int destino);
+  std::vector<int> Camino(int origen, int destino) const;
+  void Guardar(const std::string&) const;
+  void Cargar(const std::string&);
+
+ private:
+  int numero_nodos_{};
+  double tiempo_carga_ms_{};
+  // Vistas sobre los almacen_* (tabla recién calculada) o sobre el fichero proyectado
+  std::span<const double> distancias_{};
+  std::span<const int> siguientes_{};
+  std::vector<double> almacen_distancias_{};
+  std::vector<int> almacen_siguientes_{};
+  std::unique_ptr<FicheroMapeado> fichero_{};
+  // Metodos auxiliares
+  size_t Indice(int origen, int destino) const noexcept {
+    return static_cast<size_t>(destino) * numero_nodos_ + origen;
+  }
+};
+
+#endif
@@ -0,0 +1,222 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Implementación de la clase AraStar
+  * @version 1.0
+  */
+
+#include "ara_star.h"
+#include <algorithm>
+#include <functional>
+#include "heuristicas.h"
+
+/**
+ * @brief Busca un camino hasta la salida y lo mejora mientras quede presupuesto
+ * @param inicio Casilla de partida
+ * @param parametros ε inicial, paso con el que baja ε y presupuesto de tiempo
+ * @return true si hay camino; soluciones() tiene una entrada por cada mejora completada
+ *
+ * La primera búsqueda termina siempre. Las siguientes se abandonan si se agota
+ * el presupuesto, y entonces se conserva la última solución completa.
+ */
+bool AraStar::Buscar(const std::pair<size_t, size_t>& inicio, const ParametrosARA& parametros) {
+  const Reloj::time_point comienzo = Reloj::now();
+  // Convertir a Reloj::duration un presupuesto que no cabe (o infinito) no está definido:
+  // en ese caso no hay límite
+  const std::chrono::duration<double, std::milli> presupuesto{parametros.presupuesto_ms};
+  const Reloj::time_point limite =
+      presupuesto < Reloj::time_point::max() - comienzo
+          ? comienzo + std::chrono::duration_cast<Reloj::duration>(presupuesto)
+          : Reloj::time_point::max();
+  const size_t casillas = static_cast<size_t>(laberinto_->filas()) * laberinto_->columnas();
+  columnas_ = laberinto_->columnas();
+  meta_ = laberinto_->coordenadas_exit().first * columnas_ + laberinto_->coordenadas_exit().second;
+  g_.assign(casillas, kInfinito);
+  padre_.assign(casillas, kSinPadre);
+  f_en_cola_.assign(casillas, kInfinito);
+  abierta_.assign(casillas, false);
+  cerrada_en_.assign(casillas, 0);
+  es_inconsistente_.assign(casillas, false);
+  inconsistentes_.clear();
+  cola_.clear();
+  camino_.clear();
+  soluciones_.clear();
+  nodos_generados_ = 0;
+  nodos_inspeccionados_ = 0;
+
+  iteracion_ = 1;
+  epsilon_ = parametros.epsilon_inicial;
+  const size_t indice_inicio = inicio.first * columnas_ + inicio.second;
+  g_[indice_inicio] = 0.0;
+  Encolar(indice_inicio);
+  ++nodos_generados_;
+
+  while (true) {
+    const size_t inspeccionados_antes = nodos_inspeccionados_;
+    if (!MejorarCamino(limite) || g_[meta_] == kInfinito) {
+      break;
+    }
+    const double cota = CalcularCota();
+    camino_ = ExtraerCamino();
+    soluciones_.push_back({epsilon_, cota, g_[meta_], nodos_inspeccionados_ - inspeccionados_antes,
+                           std::chrono::duration<double, std::milli>(Reloj::now() - comienzo).count()});
+    if (cota <= 1.0 || Reloj::now() >= limite) {
+      break;
+    }
+    // Un ε por encima de la cota ya alcanzada no puede mejorar la solución
+    epsilon_ = std::max(1.0, std::min(epsilon_ - parametros.paso_epsilon, cota));
+    ++iteracion_;
+    ReabrirInconsistentes();
+  }
+  return !soluciones_.empty();
+}
+
+//============================================================================
+// MÉTODOS AUXILIARES
+//============================================================================
+
+/**
+ * @brief Distancia octile de una casilla a la salida
+ */
+double AraStar::Heuristica(size_t indice) const noexcept {
+  return DistanciaOctileEntre(Coordenadas(indice), Coordenadas(meta_));
+}
+
+/**
+ * @brief Inserta una casilla en OPEN con f = g + ε·h o actualiza su f
+ */
+void AraStar::Encolar(size_t indice) {
+  abierta_[indice] = true;
+  f_en_cola_[indice] = g_[indice] + epsilon_ * Heuristica(indice);
+  cola_.push_back({f_en_cola_[indice], indice});
+  std::push_heap(cola_.begin(), cola_.end(), std::greater<EntradaCola>{});
+}
+
+/**
+ * @brief Saca de la cima las entradas de casillas ya cerradas o con una f antigua
+ */
+void AraStar::DescartarObsoletas() {
+  while (!cola_.empty()) {
+    const auto& [f, indice] = cola_.front();
+    if (abierta_[indice] && f == f_en_cola_[indice]) {
+      return;
+    }
+    std::pop_heap(cola_.begin(), cola_.end(), std::greater<EntradaCola>{});
+    cola_.pop_back();
+  }
+}
+
+/**
+ * @brief ImprovePath de ARA*: expande hasta que ninguna f abierta es menor que g(salida)
+ * @param limite Instante a partir del cual se abandona la mejora (solo si ya hay una solución)
+ * @return false si se abandonó por tiempo
+ *
+ * Una casilla cerrada en esta iteración cuyo g baja no vuelve a OPEN sino a
+ * INCONS; se reabrirá en la siguiente iteración con un ε menor.
+ */
+bool AraStar::MejorarCamino(Reloj::time_point limite) {
+  // Consultar el reloj en cada expansión saldría más caro que la propia expansión
+  constexpr size_t kExpansionesEntreConsultas = 256;
+  const bool hay_solucion = !soluciones_.empty();
+  size_t expansiones = 0;
+  while (true) {
+    DescartarObsoletas();
+    if (cola_.empty() || g_[meta_] <= cola_.front().first) {
+      return true;
+    }
+    if (hay_solucion && ++expansiones % kExpansionesEntreConsultas == 0 && Reloj::now() >= limite) {
+      return false;
+    }
+    const size_t actual = cola_.front().second;
+    std::pop_heap(cola_.begin(), cola_.end(), std::greater<EntradaCola>{});
+    cola_.pop_back();
+    abierta_[actual] = false;
+    cerrada_en_[actual] = iteracion_;
+    ++nodos_inspeccionados_;
+
+    const auto [fila, columna] = Coordenadas(actual);
+    for (const Vecino& vecino : laberinto_->GetVecinosCasilla(fila, columna)) {
+      const double g_nuevo = g_[actual] + vecino.coste;
+      if (g_nuevo >= g_[vecino.indice]) {
+        continue;
+      }
+      if (g_[vecino.indice] == kInfinito) {
+        ++nodos_generados_;
+      }
+      g_[vecino.indice] = g_nuevo;
+      padre_[vecino.indice] = actual;
+      if (cerrada_en_[vecino.indice] != iteracion_) {
+        Encolar(vecino.indice);
+      } else if (!es_inconsistente_[vecino.indice]) {
+        es_inconsistente_[vecino.indice] = true;
+        inconsistentes_.push_back(vecino.indice);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Pasa INCONS a OPEN y recalcula todas las f con el ε actual
+ */
+void AraStar::ReabrirInconsistentes() {
+  std::vector<size_t> abiertas;
+  abiertas.reserve(cola_.size() + inconsistentes_.size());
+  for (const auto& [f, indice] : cola_) {
+    if (abierta_[indice] && f == f_en_cola_[indice]) {
+      abiertas.push_back(indice);
+    }
+  }
+  for (const size_t indice : inconsistentes_) {
+    es_inconsistente_[indice] = false;
+    if (!abierta_[indice]) {
+      abiertas.push_back(indice);
+    }
+  }
+  inconsistentes_.clear();
+  cola_.clear();
+  for (const size_t indice : abiertas) {
+    abierta_[indice] = true;
+    f_en_cola_[indice] = g_[indice] + epsilon_ * Heuristica(indice);
+    cola_.push_back({f_en_cola_[indice], indice});
+  }
+  std::make_heap(cola_.begin(), cola_.end(), std::greater<EntradaCola>{});
+}
+
+/**
+ * @brief Cota de subóptimo de la solución actual: min(ε, g(salida) / min(g + h) en OPEN ∪ INCONS)
+ */
+double AraStar::CalcularCota() const {
+  double minimo = kInfinito;
+  for (const auto& [f, indice] : cola_) {
+    if (abierta_[indice] && f == f_en_cola_[indice]) {
+      minimo = std::min(minimo, g_[indice] + Heuristica(indice));
+    }
+  }
+  for (const size_t indice : inconsistentes_) {
+    minimo = std::min(minimo, g_[indice] + Heuristica(indice));
+  }
+  // Sin casillas pendientes ningún camino puede mejorar al encontrado
+  if (minimo == kInfinito || minimo <= 0.0) {
+    return 1.0;
+  }
+  return std::max(1.0, std::min(epsilon_, g_[meta_] / minimo));
+}
+
+/**
+ * @brief Camino desde el inicio hasta la salida siguiendo los padres
+ */
+std::vector<std::pair<size_t, size_t>> AraStar::ExtraerCamino() const {
+  std::vector<std::pair<size_t, size_t>> camino;
+  for (size_t indice = meta_; indice != kSinPadre; indice = padre_[indice]) {
+    camino.push_back(Coordenadas(indice));
+  }
+  std::reverse(camino.begin(), camino.end());
+  return camino;
+}
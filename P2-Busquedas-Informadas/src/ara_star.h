@@ -0,0 +1,111 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Definición de la clase AraStar (A* anytime con cota de subóptimo)
+  * @version 1.0
+  */
+
+#ifndef ARA_STAR_H
+#define ARA_STAR_H
+
+#include <vector>
+#include <utility>
+#include <limits>
+#include <chrono>
+#include <cstdint>
+#include "laberinto.h"
+
+/**
+ * @struct ParametrosARA
+ * @brief Configuración de ARA*: ε de la primera solución, cuánto baja en cada mejora y tiempo disponible
+ */
+struct ParametrosARA {
+  double epsilon_inicial{3.0};
+  double paso_epsilon{0.5};
+  double presupuesto_ms{100.0};  // La primera solución se busca siempre, aunque lo supere
+};
+
+/**
+ * @struct SolucionARA
+ * @brief Una de las soluciones sucesivas de ARA*
+ */
+struct SolucionARA {
+  double epsilon{};            // Peso de la heurística en esa búsqueda
+  double cota{};               // coste <= cota × coste óptimo
+  double coste{};
+  size_t nodos_inspeccionados{};  // Expansiones de esa mejora (no acumuladas)
+  double tiempo_ms{};          // Tiempo desde el inicio de Buscar
+};
+
+/**
+ * @class AraStar
+ * @brief Anytime Repairing A* sobre un Laberinto con la heurística octile
+ *
+ * Encuentra primero un camino con A* ponderado (f = g + ε·h) y, mientras quede
+ * presupuesto, baja ε y lo mejora. Cada mejora reutiliza g y los padres de la
+ * anterior: solo se reexpanden las casillas abiertas y las que bajaron su g tras
+ * cerrarse (lista INCONS), no se repite la búsqueda desde cero.
+ *
+ * Tras cada solución la cota alcanzada es min(ε, g(salida) / min(g + h)) sobre
+ * las casillas abiertas e inconsistentes; como la octile es admisible con los
+ * costes 5/7, el coste de la solución no supera cota × coste óptimo.
+ */
+class AraStar {
+ public:
+  AraStar() = default;
+  explicit AraStar(const Laberinto& laberinto) : laberinto_{&laberinto} {}
+  AraStar(const AraStar&) = delete;
+  AraStar& operator=(const AraStar&) = delete;
+  // Metodos de utilidad
+  bool Buscar(const std::pair<size_t, size_t>& inicio, const ParametrosARA&);
+  // Google style getters
+  const std::vector<std::pair<size_t, size_t>>& camino() const noexcept { return camino_; }
+  const std::vector<SolucionARA>& soluciones() const noexcept { return soluciones_; }
+  size_t nodos_generados() const noexcept { return nodos_generados_; }
+  size_t nodos_inspeccionados() const noexcept { return nodos_inspeccionados_; }
+
+ private:
+  using EntradaCola = std::pair<double, size_t>;
+  using Reloj = std::chrono::steady_clock;
+  static constexpr double kInfinito = std::numeric_limits<double>::infinity();
+  static constexpr size_t kSinPadre = std::numeric_limits<size_t>::max();
+  const Laberinto* laberinto_{};
+  size_t columnas_{};
+  size_t meta_{};
+  double epsilon_{};
+  std::vector<double> g_{};
+  std::vector<size_t> padre_{};
+  // Montículo de mínimos con borrado perezoso: una entrada es válida si la
+  // casilla sigue abierta y su f coincide con f_en_cola_
+  std::vector<EntradaCola> cola_{};
+  std::vector<double> f_en_cola_{};
+  std::vector<bool> abierta_{};
+  // Iteración en la que se cerró cada casilla (así no hay que vaciar CLOSED al bajar ε)
+  std::vector<uint32_t> cerrada_en_{};
+  uint32_t iteracion_{};
+  std::vector<size_t> inconsistentes_{};
+  std::vector<bool> es_inconsistente_{};
+  std::vector<std::pair<size_t, size_t>> camino_{};
+  std::vector<SolucionARA> soluciones_{};
+  size_t nodos_generados_{};
+  size_t nodos_inspeccionados_{};
+
+  // Metodos auxiliares
+  std::pair<size_t, size_t> Coordenadas(size_t indice) const noexcept { return {indice / columnas_, indice % columnas_}; }
+  double Heuristica(size_t indice) const noexcept;
+  void Encolar(size_t indice);
+  void DescartarObsoletas();
+  bool MejorarCamino(Reloj::time_point limite);
+  void ReabrirInconsistentes();
+  double CalcularCota() const;
+  std::vector<std::pair<size_t, size_t>> ExtraerCamino() const;
+};
+
+#endif
@@ -16,7 +16,13 @@
 #include <set>
 #include <utility>
 #include <algorithm>
+#include <span>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 #include "busqueda_informada.h"
+#include "dstar_lite.h"
 
 //============================================================================
 // MÉTODOS PRINCIPALES DE BÚSQUEDA
@@ -25,118 +31,24 @@
 /**
  * @brief Ejecuta búsqueda A* desde una posición inicial dada
  * @param inicio Coordenadas (fila, columna) del punto de partida
+ * @param heuristica Heurística a usar (Manhattan por defecto)
  * @return true si se encontró un camino hasta la salida, false en caso contrario
- * @note Resetea estadísticas en cada ejecución
- * @see ReconstruirCamino, InicializarMatrizCostes
+ * @note La heurística se multiplica por epsilon() si es mayor que 1 (A* ponderado)
+ * @see BusquedaAStarGenerica, ConHeuristica, HeuristicaPonderada
  */
-bool BusquedaInformada::BusquedaAStar(const std::pair<size_t, size_t>& inicio) {
-  nodos_generados_ = 0;
-  nodos_inspeccionados_ = 0;
-  camino_encontrado_.clear();
-
-  InicializarMatrizCostes();
-
-  std::pair<size_t, size_t> pos_actual = inicio;
-  double g_cost = 0; 
-  double h_cost = laberinto_->HeuristicaManhattan(pos_actual.first, pos_actual.second);
-  
-  nodo S(pos_actual, g_cost, h_cost, {-1, -1});
-  std::cerr << "Nodo inicial: " << S;
-  matriz_costes_[pos_actual.first][pos_actual.second] = S;
-  A_.push_back(S);
-  ++nodos_generados_;
-
-  // Paso 2: Repetir mientras A no esté vacía
-  while (!A_.empty()) {
-    // Paso 2(a): Seleccionar el nodo de menor coste f(n)
-    auto it_mejor = A_.begin();
-    for (auto it = A_.begin(); it != A_.end(); ++it) {
-      if (it->f_cost < it_mejor->f_cost) {
-        it_mejor = it;
-      }
-    }
-    nodo actual = *it_mejor;
-    A_.erase(it_mejor);
-    
-    // Insertarlo en la lista de nodos cerrados C
-    C_.insert(actual.posicion);
-    ++nodos_inspeccionados_;
-    std::cerr << "Procesando nodo: " << actual;
-    
-    // Verificar si llegamos a la salida
-    if (actual.posicion == laberinto_->coordenadas_exit()) {
-      std::cerr << "¡Camino encontrado!" << std::endl;
-      camino_encontrado_ = ReconstruirCamino(actual.posicion);
-      return true;
-    }
-    
-    // Paso 2(b): Para cada nodo vecino
-    std::vector<std::pair<size_t, size_t>> vecinos = 
-        laberinto_->GetVecinosCasilla(actual.posicion.first, actual.posicion.second);
-    
-    for (const auto& vecino_pos : vecinos) {
-      size_t vecino_fila = vecino_pos.first;
-      size_t vecino_col = vecino_pos.second;
-      
-      // Calcular costes para el vecino
-      double move_cost = laberinto_->MoveCost(actual.posicion.first, actual.posicion.second, 
-                                             vecino_fila, vecino_col);
-      double g_cost_vecino = actual.g_cost + move_cost;
-      double h_cost_vecino = laberinto_->HeuristicaManhattan(vecino_fila, vecino_col);
-      
-      nodo vecino(vecino_pos, g_cost_vecino, h_cost_vecino, 
-                 {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)});
-      
-      // Verificar si el nodo está en C (cerrados)
-      bool en_C = (C_.find(vecino_pos) != C_.end());
-
-      // Verificar si el nodo está en A (abiertos)
-      bool en_A = false;
-      auto it_en_A = A_.end();
-      for (auto it = A_.begin(); it != A_.end(); ++it) {
-        if (it->posicion == vecino_pos) {
-          en_A = true;
-          it_en_A = it;
-          break;
-        }
-      }
-      
-      // Paso 2(b)i: Si el nodo no está ni en A ni en C
-      if (!en_A && !en_C) {
-        vecino.padre = {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)};
-        matriz_costes_[vecino_fila][vecino_col] = vecino;
-        A_.push_back(vecino);
-        ++nodos_generados_;
-        std::cerr << "  Nuevo nodo añadido a A: " << vecino;
-      }
-      // Paso 2(b)ii: Si el nodo está en A
-      else if (en_A) {
-        // Verificar si encontramos un camino mejor (menor g_cost)
-        if (g_cost_vecino < it_en_A->g_cost) {
-          std::cerr << "  Actualizando nodo en A: g_cost mejorado de " 
-                    << it_en_A->g_cost << " a " << g_cost_vecino << std::endl;
-          
-          // Actualizar coste g(n) y por lo tanto f(n)
-          it_en_A->g_cost = g_cost_vecino;
-          it_en_A->f_cost = g_cost_vecino + it_en_A->h_cost;
-          it_en_A->padre = {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)};
-          
-          // Actualizar también en la matriz de costes
-          matriz_costes_[vecino_fila][vecino_col] = *it_en_A;
-        }
-      }
-      // Si el nodo está en C, no hacemos nada (ya fue procesado)
+bool BusquedaInformada::BusquedaAStar(const std::pair<size_t, size_t>& inicio, TipoHeuristica heuristica) {
+  return ConHeuristica(heuristica, *laberinto_, [&](const auto& h) {
+    if (epsilon_ == 1.0) {
+      return BusquedaAStarGenerica(inicio, h);
     }
-  }
-  
-  // Paso 3: Si A está vacía y no se llegó a la salida
-  std::cout << "No existe camino desde la entrada hasta la salida." << std::endl;
-  return false;
+    return BusquedaAStarGenerica(inicio, HeuristicaPonderada{h, epsilon_});
+  });
 }
 
 /**
  * @brief Ejecuta búsqueda A* en entorno dinámico
  * @param output_file Fichero de salida donde se guarda la memoria
+ * @param heuristica Heurística de cada planificación (Manhattan por defecto)
  * @return true si el agente llegó a la meta, false si no es posible
  * Simula un agente navegando en un entorno que cambia dinámicamente:
  * Algoritmo:
@@ -158,7 +70,24 @@ bool BusquedaInformada::BusquedaAStar(const std::pair<size_t, size_t>& inicio) {
  * @note Máximo 5 reintentos consecutivos sin camino antes de abortar
  * @see ActualizarDinamismo, ImprimirLaberintoConCaminoYAgente
  */
-bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file) {
+bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file, TipoHeuristica heuristica) {
+  return EjecutarEntornoDinamico(output_file, "A*", {[&](const std::pair<size_t, size_t>& desde) {
+    return BusquedaAStar(desde, heuristica);
+  }});
+}
+
+/**
+ * @brief Bucle del entorno dinámico común a A*, D* Lite, JPS y ARA*
+ * @param output_file Fichero de salida donde se guarda la memoria
+ * @param nombre Nombre del algoritmo en la traza y en el fichero
+ * @param planificador planificar debe dejar camino_encontrado_, los contadores de nodos,
+ *                     A_, C_ y el coste de la salida en matriz_costes_; tras_dinamismo
+ *                     y metricas son opcionales (ver PlanificadorDinamico)
+ * @return true si el agente llegó a la meta, false si no es posible
+ * @see BusquedaAStarDinamica, BusquedaDStarLiteDinamica, BusquedaJPSDinamica
+ */
+bool BusquedaInformada::EjecutarEntornoDinamico(const std::string& output_file, const std::string& nombre,
+                                                const PlanificadorDinamico& planificador) {
   if (!laberinto_) {
     std::cerr << "Error: Laberinto no configurado.\n";
     return false;
@@ -183,10 +112,25 @@ bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file) {
 
   std::vector<std::pair<size_t, size_t>> camino_real_seguido;
   camino_real_seguido.push_back(posicion_actual);
-
-  std::cerr << "\n=== INICIANDO BÚSQUEDA A* DINÁMICA ===\n";
-  std::cerr << "Inicio: (" << posicion_actual.first << "," << posicion_actual.second << ")\n";
-  std::cerr << "Meta: (" << exit_pos.first << "," << exit_pos.second << ")\n\n";
+  auto metricas_resumen = [&]() {
+    std::vector<std::pair<std::string, size_t>> metricas =
+        planificador.metricas ? planificador.metricas(true) : std::vector<std::pair<std::string, size_t>>{};
+    for (auto& metrica : MetricasReplanificacion()) metricas.push_back(std::move(metrica));
+    return metricas;
+  };
+
+  // Con la política solo_si_bloqueado A* solo se repite cuando DebeReplanificar lo indica
+  bool replanificar = true;
+  std::vector<std::pair<size_t, size_t>> liberadas_desde_plan;
+  replanificaciones_ = 0;
+  replanificaciones_evitadas_ = 0;
+  paso_camino_ = 0;
+
+  if (Trazar(NivelTraza::kResumen)) {
+    std::cerr << "\n=== INICIANDO BÚSQUEDA " << nombre << " DINÁMICA ===\n";
+    std::cerr << "Inicio: (" << posicion_actual.first << "," << posicion_actual.second << ")\n";
+    std::cerr << "Meta: (" << exit_pos.first << "," << exit_pos.second << ")\n\n";
+  }
 
   while (posicion_actual != exit_pos) {
     ++iteracion;
@@ -197,12 +141,23 @@ bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file) {
     archivo_salida << "Posición actual del agente: (" 
                    << posicion_actual.first << "," << posicion_actual.second << ")\n\n";
 
-    std::cerr << "Iteración " << iteracion << ": Ejecutando A* desde (" 
-              << posicion_actual.first << "," << posicion_actual.second << ")...\n";
+    if (Trazar(NivelTraza::kIteracion)) {
+      std::cerr << "Iteración " << iteracion << ": Ejecutando " << nombre << " desde (" 
+                << posicion_actual.first << "," << posicion_actual.second << ")...\n";
+    }
 
-    A_.clear();
-    C_.clear();
-    bool camino_encontrado = BusquedaAStar(posicion_actual);
+    bool camino_encontrado = true;
+    if (replanificar) {
+      camino_encontrado = planificador.planificar(posicion_actual);
+      paso_camino_ = 0;
+      ++replanificaciones_;
+      liberadas_desde_plan.clear();
+    } else {
+      ++replanificaciones_evitadas_;
+      nodos_generados_ = 0;
+      nodos_inspeccionados_ = 0;
+      archivo_salida << "El camino restante sigue libre: se reutiliza sin repetir " << nombre << "\n\n";
+    }
 
     if (camino_encontrado) {
       reintentos_sin_exito_consecutivos = 0;
@@ -216,43 +171,59 @@ bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file) {
       nodos_generados_acumulados += nodos_generados_;
       nodos_inspeccionados_acumulados += nodos_inspeccionados_;
 
-      archivo_salida << "Camino planificado (longitud " << camino_encontrado_.size() << "):\n";
-      for (const auto& [f, c] : camino_encontrado_) {
+      const std::span<const std::pair<size_t, size_t>> camino_restante = CaminoRestante();
+      archivo_salida << "Camino planificado (longitud " << camino_restante.size() << "):\n";
+      for (const auto& [f, c] : camino_restante) {
         archivo_salida << "(" << f << "," << c << ") ";
       }
       archivo_salida << "\n\n";
 
-      if (!camino_encontrado_.empty()) {
-        auto [exit_f, exit_c] = laberinto_->coordenadas_exit();
-        double coste_camino_planificado = matriz_costes_[exit_f][exit_c].g_cost;
+      if (!camino_restante.empty()) {
+        double coste_camino_planificado = replanificar ? matriz_costes_.g_cost(laberinto_->coordenadas_exit())
+                                                       : laberinto_->CalcularCosteCamino(camino_restante);
         archivo_salida << "Coste del camino planificado: " << coste_camino_planificado << "\n\n";
       }
 
       archivo_salida << "Estadísticas de esta planificación:\n";
       archivo_salida << "  - Nodos generados: " << nodos_generados_ << "\n";
-      archivo_salida << "  - Nodos inspeccionados: " << nodos_inspeccionados_ << "\n\n";
+      archivo_salida << "  - Nodos inspeccionados: " << nodos_inspeccionados_ << "\n";
+      if (replanificar && planificador.metricas) {
+        for (const auto& [metrica, valor] : planificador.metricas(false)) {
+          archivo_salida << "  - " << metrica << ": " << valor << "\n";
+        }
+      }
+      archivo_salida << "\n";
       // Mostrar listas de nodos inspeccionados y generados
-      ImprimirNodosGeneradosEInspeccionados(archivo_salida, A_, C_);  
-      if (camino_encontrado_.size() >= 2) {
-        posicion_actual = camino_encontrado_[1];
+      if (replanificar) {
+        ImprimirNodosGeneradosEInspeccionados(archivo_salida, A_, C_);
+      }
+      if (camino_restante.size() >= 2) {
+        posicion_actual = camino_restante[1];
+        // El camino restante empieza siempre en la posición del agente
+        ++paso_camino_;
         camino_real_seguido.push_back(posicion_actual);
         ++pasos_totales;
 
         archivo_salida << "Agente avanza a: (" 
                        << posicion_actual.first << "," << posicion_actual.second << ")\n\n";
         
-        std::cerr << " Avanzó a (" << posicion_actual.first << "," 
-                  << posicion_actual.second << ")\n";
+        if (Trazar(NivelTraza::kIteracion)) {
+          std::cerr << " Avanzó a (" << posicion_actual.first << "," 
+                    << posicion_actual.second << ")\n";
+        }
 
         if (posicion_actual == exit_pos) {
           archivo_salida << "*** ¡AGENTE LLEGÓ A LA META! ***\n\n";
-          std::cerr << "\n¡ÉXITO! El agente llegó a la meta.\n";
+          if (Trazar(NivelTraza::kResumen)) {
+            std::cerr << "\n¡ÉXITO! El agente llegó a la meta.\n";
+          }
           break;
         }
 
         archivo_salida << "Actualizando entorno dinámico...\n\n";
         laberinto_->ActualizarDinamismo();
-        
+        if (planificador.tras_dinamismo) planificador.tras_dinamismo(posicion_actual);
+        replanificar = DebeReplanificar(liberadas_desde_plan);
       } else {
         archivo_salida << "*** ¡AGENTE YA ESTÁ EN LA META! ***\n\n";
         break;
@@ -263,8 +234,10 @@ bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file) {
       archivo_salida << "Reintento " << (reintentos_sin_exito_consecutivos + 1) 
                      << " de " << MAX_REINTENTOS << "\n\n";
       
-      std::cerr << "  No hay camino. Reintento " << (reintentos_sin_exito_consecutivos + 1) 
-                << "/" << MAX_REINTENTOS << "\n";
+      if (Trazar(NivelTraza::kIteracion)) {
+        std::cerr << "  No hay camino. Reintento " << (reintentos_sin_exito_consecutivos + 1) 
+                  << "/" << MAX_REINTENTOS << "\n";
+      }
 
       ++reintentos_sin_exito_consecutivos;
 
@@ -272,20 +245,24 @@ bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file) {
         archivo_salida << "*** MÁXIMO DE REINTENTOS ALCANZADO ***\n";
         archivo_salida << "*** NO ES POSIBLE LLEGAR AL DESTINO ***\n\n";
         
-        std::cerr << "\nFALLO: No se pudo llegar al destino tras " 
-                  << MAX_REINTENTOS << " reintentos.\n";
+        if (Trazar(NivelTraza::kResumen)) {
+          std::cerr << "\nFALLO: No se pudo llegar al destino tras " 
+                    << MAX_REINTENTOS << " reintentos.\n";
+        }
         
         double coste_final = laberinto_->CalcularCosteCamino(camino_real_seguido);
 
         ImprimirResumenFinal(archivo_salida, iteracion, pasos_totales, 
                            nodos_generados_acumulados, nodos_inspeccionados_acumulados, coste_final,
-                           camino_real_seguido, false);
+                           camino_real_seguido, false, metricas_resumen());
         archivo_salida.close();
+        DescartarPasosDados();
         return false;
       }
 
       archivo_salida << "Actualizando entorno para reintentar...\n\n";
       laberinto_->ActualizarDinamismo();
+      if (planificador.tras_dinamismo) planificador.tras_dinamismo(posicion_actual);
     }
   }
 
@@ -293,13 +270,409 @@ bool BusquedaInformada::BusquedaAStarDinamica(const std::string& output_file) {
 
   ImprimirResumenFinal(archivo_salida, iteracion, pasos_totales, 
                       nodos_generados_acumulados, nodos_inspeccionados_acumulados, coste_final,
-                      camino_real_seguido, true);
+                      camino_real_seguido, true, metricas_resumen());
 
   archivo_salida.close();
-  std::cerr << "\nResultados guardados en: " << output_file << "\n";
+  DescartarPasosDados();
+  if (Trazar(NivelTraza::kResumen)) {
+    std::cerr << "\nResultados guardados en: " << output_file << "\n";
+  }
   return true;
 }
 
+/**
+ * @brief Ejecuta el entorno dinámico replanificando de forma incremental con D* Lite
+ * @param output_file Fichero de salida donde se guarda la memoria
+ * @return true si el agente llegó a la meta, false si no es posible
+ *
+ * Usa el bucle de EjecutarEntornoDinamico, pero el planificador conserva g/rhs entre
+ * iteraciones: tras cada paso solo recibe la nueva posición del agente y la lista de
+ * casillas cambiadas (Laberinto::cambios_dinamismo()) y repara la región afectada.
+ * Cada iteración informa además de los nodos tocados (casillas cuyo rhs se
+ * recalculó), que con pocos cambios son muchos menos que en A*. Las listas A y C
+ * son propias de DStarLite, así que en los reportes quedan vacías.
+ *
+ * @note Máximo 5 reintentos consecutivos sin camino antes de abortar
+ * @see DStarLite
+ */
+bool BusquedaInformada::BusquedaDStarLiteDinamica(const std::string& output_file) {
+  if (!laberinto_) {
+    std::cerr << "Error: Laberinto no configurado.\n";
+    return false;
+  }
+
+  DStarLite dstar{*laberinto_};
+  dstar.Inicializar(laberinto_->coordenadas_start(), laberinto_->coordenadas_exit());
+  size_t nodos_tocados = 0;
+  size_t nodos_tocados_acumulados = 0;
+
+  PlanificadorDinamico planificador;
+  planificador.planificar = [&](const std::pair<size_t, size_t>&) {
+    // La primera iteración resuelve el problema completo; las siguientes solo reparan
+    camino_encontrado_.clear();
+    matriz_costes_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+    A_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+    C_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+    const bool encontrado = dstar.CalcularCaminoMasCorto();
+    if (encontrado) camino_encontrado_ = dstar.ExtraerCamino();
+    nodos_generados_ = dstar.nodos_generados();
+    nodos_inspeccionados_ = dstar.nodos_inspeccionados();
+    // Los tocados incluyen los de NotificarCambios desde la planificación anterior
+    nodos_tocados = dstar.nodos_tocados();
+    nodos_tocados_acumulados += nodos_tocados;
+    dstar.ReiniciarContadores();
+    FijarCostesCamino();
+    return encontrado && !camino_encontrado_.empty();
+  };
+  planificador.tras_dinamismo = [&](const std::pair<size_t, size_t>& posicion) {
+    dstar.MoverInicio(posicion);
+    dstar.NotificarCambios(laberinto_->cambios_dinamismo());
+  };
+  planificador.metricas = [&](bool acumuladas) -> std::vector<std::pair<std::string, size_t>> {
+    if (acumuladas) return {{"Total nodos tocados (acumulado)", nodos_tocados_acumulados}};
+    return {{"Nodos tocados", nodos_tocados}};
+  };
+  return EjecutarEntornoDinamico(output_file, "D* LITE", planificador);
+}
+
+//============================================================================
+// JUMP POINT SEARCH
+//============================================================================
+
+/**
+ * @brief Direcciones (diff_fila, diff_columna) que hay que explorar desde un punto de salto
+ */
+struct DireccionesJPS {
+  std::array<std::pair<int, int>, 8> direcciones{};
+  size_t cantidad{};
+  void Anadir(int diff_fila, int diff_columna) noexcept { direcciones[cantidad++] = {diff_fila, diff_columna}; }
+  const std::pair<int, int>* begin() const noexcept { return direcciones.data(); }
+  const std::pair<int, int>* end() const noexcept { return direcciones.data() + cantidad; }
+};
+
+/**
+ * @brief Signo de un entero (-1, 0 o 1)
+ */
+static int Signo(long valor) noexcept {
+  return (valor > 0) - (valor < 0);
+}
+
+/**
+ * @brief Direcciones podadas de JPS desde una casilla a la que se llegó desde padre
+ * @param laberinto Laberinto sobre el que se busca
+ * @param posicion Casilla que se expande
+ * @param padre Punto de salto anterior ({-1, -1} en el nodo inicial)
+ * @return Dirección natural y direcciones forzadas
+ *
+ * Las reglas son las de EsMovimientoValido: un diagonal solo está prohibido si
+ * las dos esquinas son obstáculos, así que un vecino es forzado cuando la
+ * esquina que lo haría innecesario está bloqueada pero la otra no. El nodo
+ * inicial no tiene padre y explora todos sus vecinos.
+ */
+static DireccionesJPS PodarDirecciones(const Laberinto& laberinto, const std::pair<size_t, size_t>& posicion,
+                                       const std::pair<int, int>& padre) {
+  DireccionesJPS resultado;
+  const long f = static_cast<long>(posicion.first);
+  const long c = static_cast<long>(posicion.second);
+  if (padre.first < 0) {
+    for (const Vecino& vecino : laberinto.GetVecinosCasilla(posicion.first, posicion.second)) {
+      resultado.Anadir(Signo(static_cast<long>(vecino.posicion.first) - f),
+                       Signo(static_cast<long>(vecino.posicion.second) - c));
+    }
+    return resultado;
+  }
+  const int df = Signo(f - padre.first);
+  const int dc = Signo(c - padre.second);
+  if (df != 0 && dc != 0) {
+    const bool vertical_libre = laberinto.EsTransitable(f + df, c);
+    const bool horizontal_libre = laberinto.EsTransitable(f, c + dc);
+    if (vertical_libre) resultado.Anadir(df, 0);
+    if (horizontal_libre) resultado.Anadir(0, dc);
+    if (vertical_libre || horizontal_libre) resultado.Anadir(df, dc);
+    if (!laberinto.EsTransitable(f, c - dc) && vertical_libre) resultado.Anadir(df, -dc);
+    if (!laberinto.EsTransitable(f - df, c) && horizontal_libre) resultado.Anadir(-df, dc);
+  } else if (df != 0) {
+    if (laberinto.EsTransitable(f + df, c)) {
+      resultado.Anadir(df, 0);
+      if (!laberinto.EsTransitable(f, c + 1)) resultado.Anadir(df, 1);
+      if (!laberinto.EsTransitable(f, c - 1)) resultado.Anadir(df, -1);
+    }
+  } else {
+    if (laberinto.EsTransitable(f, c + dc)) {
+      resultado.Anadir(0, dc);
+      if (!laberinto.EsTransitable(f + 1, c)) resultado.Anadir(1, dc);
+      if (!laberinto.EsTransitable(f - 1, c)) resultado.Anadir(-1, dc);
+    }
+  }
+  return resultado;
+}
+
+/**
+ * @brief Salto en línea recta desde una casilla
+ * @param laberinto Laberinto sobre el que se busca
+ * @param tabla Saltos precalculados (JPS+) o nullptr para recorrer la recta (JPS)
+ * @param fila Fila de origen
+ * @param columna Columna de origen
+ * @param diff_fila Dirección en filas (0 si es horizontal)
+ * @param diff_columna Dirección en columnas (0 si es vertical)
+ * @return El primer punto de salto o la salida, o std::nullopt si antes hay un obstáculo
+ */
+static std::optional<std::pair<size_t, size_t>> SaltarRecto(const Laberinto& laberinto, const TablaSaltos* tabla,
+                                                             long fila, long columna, int diff_fila, int diff_columna) {
+  const auto [salida_f, salida_c] = laberinto.coordenadas_exit();
+  if (tabla) {
+    const int32_t salto = tabla->salto(static_cast<size_t>(fila), static_cast<size_t>(columna),
+                                       TablaSaltos::DireccionDe(diff_fila, diff_columna));
+    // La salida depende de la búsqueda, así que no está en la tabla: se mira si cae en el tramo recorrido
+    const long alcance = salto > 0 ? salto : -salto;
+    const long distancia = diff_fila != 0 ? (static_cast<long>(salida_f) - fila) * diff_fila
+                                          : (static_cast<long>(salida_c) - columna) * diff_columna;
+    const bool en_la_recta = diff_fila != 0 ? static_cast<long>(salida_c) == columna : static_cast<long>(salida_f) == fila;
+    if (en_la_recta && distancia >= 1 && distancia <= alcance) {
+      return laberinto.coordenadas_exit();
+    }
+    if (salto <= 0) {
+      return std::nullopt;
+    }
+    return std::make_pair(static_cast<size_t>(fila + salto * diff_fila), static_cast<size_t>(columna + salto * diff_columna));
+  }
+  long f = fila + diff_fila;
+  long c = columna + diff_columna;
+  while (laberinto.EsTransitable(f, c)) {
+    if ((static_cast<size_t>(f) == salida_f && static_cast<size_t>(c) == salida_c) ||
+        TablaSaltos::EsSaltoRectoForzado(laberinto, f, c, diff_fila, diff_columna)) {
+      return std::make_pair(static_cast<size_t>(f), static_cast<size_t>(c));
+    }
+    f += diff_fila;
+    c += diff_columna;
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Salto desde una casilla en cualquiera de las 8 direcciones
+ * @return El primer punto de salto o la salida, o std::nullopt si no hay ninguno
+ *
+ * En diagonal se avanza casilla a casilla y en cada una se prueban los dos saltos
+ * rectos que salen de ella; si alguno encuentra algo, la casilla es punto de salto.
+ */
+static std::optional<std::pair<size_t, size_t>> Saltar(const Laberinto& laberinto, const TablaSaltos* tabla,
+                                                       const std::pair<size_t, size_t>& origen,
+                                                       int diff_fila, int diff_columna) {
+  long f = static_cast<long>(origen.first);
+  long c = static_cast<long>(origen.second);
+  if (diff_fila == 0 || diff_columna == 0) {
+    return SaltarRecto(laberinto, tabla, f, c, diff_fila, diff_columna);
+  }
+  const std::pair<size_t, size_t> salida = laberinto.coordenadas_exit();
+  while (true) {
+    const long siguiente_f = f + diff_fila;
+    const long siguiente_c = c + diff_columna;
+    if (!laberinto.EsTransitable(siguiente_f, siguiente_c) ||
+        (!laberinto.EsTransitable(f, siguiente_c) && !laberinto.EsTransitable(siguiente_f, c))) {
+      return std::nullopt;
+    }
+    f = siguiente_f;
+    c = siguiente_c;
+    const std::pair<size_t, size_t> actual{static_cast<size_t>(f), static_cast<size_t>(c)};
+    if (actual == salida) {
+      return actual;
+    }
+    if ((laberinto.EsTransitable(f + diff_fila, c - diff_columna) && !laberinto.EsTransitable(f, c - diff_columna)) ||
+        (laberinto.EsTransitable(f - diff_fila, c + diff_columna) && !laberinto.EsTransitable(f - diff_fila, c))) {
+      return actual;
+    }
+    if (SaltarRecto(laberinto, tabla, f, c, 0, diff_columna) || SaltarRecto(laberinto, tabla, f, c, diff_fila, 0)) {
+      return actual;
+    }
+  }
+}
+
+/**
+ * @brief Búsqueda Jump Point Search desde una posición inicial
+ * @param inicio Coordenadas (fila, columna) del punto de partida
+ * @param modo kJPS recorre las rectas; kJPSPlus usa la tabla de saltos, que se
+ *             actualiza aquí con los cambios del laberinto desde la última búsqueda
+ * @return true si se encontró un camino hasta la salida, false en caso contrario
+ *
+ * Es A* con la heurística octile sobre los puntos de salto: los nodos generados
+ * e inspeccionados son solo puntos de salto y el coste de cada tramo es su
+ * distancia octile (todo el tramo es recto o diagonal). El camino se expande
+ * después casilla a casilla, así que camino_encontrado_ y el coste de la salida
+ * en matriz_costes_ tienen el mismo formato que tras BusquedaAStar.
+ */
+bool BusquedaInformada::BusquedaJPS(const std::pair<size_t, size_t>& inicio, ModoJPS modo) {
+  nodos_generados_ = 0;
+  nodos_inspeccionados_ = 0;
+  camino_encontrado_.clear();
+
+  matriz_costes_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+  A_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+  C_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+  const TablaSaltos* tabla = nullptr;
+  if (modo == ModoJPS::kJPSPlus) {
+    tabla_saltos_.Sincronizar(*laberinto_);
+    tabla = &tabla_saltos_;
+  }
+  const DistanciaOctile heuristica{*laberinto_};
+
+  nodo S(inicio, 0.0, heuristica(inicio.first, inicio.second), {-1, -1});
+  if (Trazar(NivelTraza::kResumen)) {
+    std::cerr << "Nodo inicial: " << S;
+  }
+  matriz_costes_.Fijar(S);
+  A_.Insertar(S);
+  ++nodos_generados_;
+
+  while (!A_.empty()) {
+    nodo actual = A_.ExtraerMejor();
+    C_.Insertar(actual.posicion);
+    ++nodos_inspeccionados_;
+    if (Trazar(NivelTraza::kIteracion)) {
+      std::cerr << "Procesando punto de salto: " << actual;
+    }
+
+    if (actual.posicion == laberinto_->coordenadas_exit()) {
+      if (Trazar(NivelTraza::kResumen)) {
+        std::cerr << "¡Camino encontrado!" << std::endl;
+      }
+      // Cada par de puntos de salto consecutivos está en la misma recta o diagonal
+      const std::vector<std::pair<size_t, size_t>> saltos = ReconstruirCamino(actual.posicion);
+      camino_encontrado_.push_back(saltos.front());
+      for (size_t i = 1; i < saltos.size(); ++i) {
+        const int df = Signo(static_cast<long>(saltos[i].first) - static_cast<long>(saltos[i - 1].first));
+        const int dc = Signo(static_cast<long>(saltos[i].second) - static_cast<long>(saltos[i - 1].second));
+        while (camino_encontrado_.back() != saltos[i]) {
+          const auto [f, c] = camino_encontrado_.back();
+          camino_encontrado_.push_back({static_cast<size_t>(static_cast<long>(f) + df),
+                                        static_cast<size_t>(static_cast<long>(c) + dc)});
+        }
+      }
+      return true;
+    }
+
+    const std::pair<int, int> padre_salto{static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)};
+    for (const auto& [df, dc] : PodarDirecciones(*laberinto_, actual.posicion, actual.padre)) {
+      const auto salto = Saltar(*laberinto_, tabla, actual.posicion, df, dc);
+      if (!salto || C_.Contiene(*salto)) {
+        continue;
+      }
+      const auto [fila, columna] = *salto;
+      const double g_cost = actual.g_cost + DistanciaOctileEntre(actual.posicion, *salto);
+      if (!A_.Contiene(*salto)) {
+        nodo sucesor(*salto, g_cost, heuristica(fila, columna), padre_salto);
+        matriz_costes_.Fijar(sucesor);
+        A_.Insertar(sucesor);
+        ++nodos_generados_;
+        if (Trazar(NivelTraza::kVecino)) {
+          std::cerr << "  Nuevo punto de salto añadido a A: " << sucesor;
+        }
+      } else if (g_cost < A_.Obtener(*salto).g_cost) {
+        if (Trazar(NivelTraza::kVecino)) {
+          std::cerr << "  Actualizando punto de salto en A: g_cost mejorado de "
+                    << A_.Obtener(*salto).g_cost << " a " << g_cost << std::endl;
+        }
+        A_.MejorarCoste(*salto, g_cost, padre_salto);
+        matriz_costes_.Fijar(A_.Obtener(*salto));
+      }
+    }
+  }
+
+  std::cout << "No existe camino desde la entrada hasta la salida." << std::endl;
+  return false;
+}
+
+/**
+ * @brief Ejecuta el entorno dinámico planificando con JPS en lugar de A*
+ * @param output_file Fichero de salida donde se guarda la memoria
+ * @param modo Variante de JPS (JPS+ por defecto)
+ * @return true si el agente llegó a la meta, false si no es posible
+ *
+ * Con JPS+ la tabla de saltos no se reconstruye en cada paso: cada búsqueda
+ * recalcula solo las filas y columnas vecinas de las casillas que cambiaron.
+ */
+bool BusquedaInformada::BusquedaJPSDinamica(const std::string& output_file, ModoJPS modo) {
+  return EjecutarEntornoDinamico(output_file, modo == ModoJPS::kJPSPlus ? "JPS+" : "JPS",
+                                 {[&](const std::pair<size_t, size_t>& desde) { return BusquedaJPS(desde, modo); }});
+}
+
+//============================================================================
+// ARA* (A* ANYTIME)
+//============================================================================
+
+/**
+ * @brief Búsqueda ARA* desde una posición inicial con los parámetros de parametros_ara()
+ * @param inicio Coordenadas (fila, columna) del punto de partida
+ * @return true si se encontró un camino hasta la salida, false en caso contrario
+ *
+ * Deja en camino_encontrado_ la mejor solución obtenida dentro del presupuesto y
+ * en soluciones_ara() el ε, la cota, el coste y el tiempo de cada mejora. Los
+ * nodos generados e inspeccionados son los de todas las mejoras juntas. Las
+ * listas A y C son propias de AraStar, así que aquí quedan vacías, y en
+ * matriz_costes_ solo se rellenan las casillas del camino para que los
+ * reportes lean el coste como tras BusquedaAStar.
+ * @see AraStar
+ */
+bool BusquedaInformada::BusquedaARAStar(const std::pair<size_t, size_t>& inicio) {
+  camino_encontrado_.clear();
+  matriz_costes_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+  A_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+  C_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+
+  AraStar planificador{*laberinto_};
+  const bool encontrado = planificador.Buscar(inicio, parametros_ara_);
+  nodos_generados_ = planificador.nodos_generados();
+  nodos_inspeccionados_ = planificador.nodos_inspeccionados();
+  soluciones_ara_ = planificador.soluciones();
+  if (!encontrado) {
+    std::cout << "No existe camino desde la entrada hasta la salida." << std::endl;
+    return false;
+  }
+  if (Trazar(NivelTraza::kResumen)) {
+    for (const SolucionARA& solucion : soluciones_ara_) {
+      std::cerr << "ARA*: epsilon=" << solucion.epsilon << " cota=" << solucion.cota
+                << " coste=" << solucion.coste << " (" << solucion.tiempo_ms << " ms)\n";
+    }
+  }
+
+  camino_encontrado_ = planificador.camino();
+  FijarCostesCamino();
+  return true;
+}
+
+/**
+ * @brief Rellena matriz_costes_ con g y padre de las casillas de camino_encontrado_
+ *
+ * Para los planificadores que no usan matriz_costes_ (ARA*, D* Lite): así los
+ * reportes y el bucle dinámico leen el coste de la salida como tras BusquedaAStar.
+ */
+void BusquedaInformada::FijarCostesCamino() {
+  std::pair<int, int> padre{-1, -1};
+  double g_cost = 0.0;
+  for (size_t i = 0; i < camino_encontrado_.size(); ++i) {
+    const auto [fila, columna] = camino_encontrado_[i];
+    if (i > 0) {
+      const auto [fila_anterior, columna_anterior] = camino_encontrado_[i - 1];
+      g_cost += laberinto_->MoveCost(fila_anterior, columna_anterior, fila, columna);
+    }
+    matriz_costes_.Fijar(nodo(camino_encontrado_[i], g_cost, 0.0, padre));
+    padre = {static_cast<int>(fila), static_cast<int>(columna)};
+  }
+}
+
+/**
+ * @brief Ejecuta el entorno dinámico planificando con ARA* en cada paso
+ * @param output_file Fichero de salida donde se guarda la memoria
+ * @return true si el agente llegó a la meta, false si no es posible
+ *
+ * Cada planificación tiene el presupuesto de parametros_ara(): el agente avanza
+ * con el mejor camino que dé tiempo a encontrar.
+ */
+bool BusquedaInformada::BusquedaARAStarDinamica(const std::string& output_file) {
+  return EjecutarEntornoDinamico(output_file, "ARA*",
+                                 {[&](const std::pair<size_t, size_t>& desde) { return BusquedaARAStar(desde); }});
+}
+
 //============================================================================
 // MÉTODOS DE VISUALIZACIÓN Y REPORTES
 //============================================================================
@@ -338,7 +711,7 @@ void BusquedaInformada::GenerarReporteCompleto(
     auto start = laberinto_->coordenadas_start();
     auto exit = laberinto_->coordenadas_exit();
     double coste_total = camino_encontrado_.empty() ? 0.0 : 
-                        matriz_costes_[exit.first][exit.second].g_cost;
+                        matriz_costes_.g_cost(exit);
     
     os << "| " << nombre_instancia 
        << " | " << laberinto_->filas()
@@ -363,6 +736,7 @@ void BusquedaInformada::GenerarReporteCompleto(
         
         // Imprimir laberinto con camino marcado
         for (size_t i = 0; i < static_cast<size_t>(laberinto_->filas()); ++i) {
+            const std::span<const Casilla> fila = laberinto_->Fila(i);
             for (size_t j = 0; j < static_cast<size_t>(laberinto_->columnas()); ++j) {
                 std::pair<size_t, size_t> pos_actual(i, j);
                 
@@ -375,7 +749,7 @@ void BusquedaInformada::GenerarReporteCompleto(
                         os << "*";  // Camino
                     }
                 } else {
-                    os << laberinto_->getCasilla(i, j).ImprimirCasilla();
+                    os << fila[j].ImprimirCasilla();
                 }
                 
                 if (j + 1 < static_cast<size_t>(laberinto_->columnas())) os << ' ';
@@ -444,7 +818,7 @@ void BusquedaInformada::ImprimirLaberintoConCaminoYAgente(
     
     // Crear conjuntos para búsquedas rápidas
     std::set<std::pair<size_t, size_t>> camino_planificado_set;
-    for (const auto& pos : camino_encontrado_) {
+    for (const auto& pos : CaminoRestante()) {
         camino_planificado_set.insert(pos);
     }
     
@@ -457,6 +831,7 @@ void BusquedaInformada::ImprimirLaberintoConCaminoYAgente(
     auto exit = laberinto_->coordenadas_exit();
     
     for (size_t i = 0; i < static_cast<size_t>(laberinto_->filas()); ++i) {
+        const std::span<const Casilla> fila = laberinto_->Fila(i);
         for (size_t j = 0; j < static_cast<size_t>(laberinto_->columnas()); ++j) {
             std::pair<size_t, size_t> pos_actual(i, j);
             
@@ -483,7 +858,7 @@ void BusquedaInformada::ImprimirLaberintoConCaminoYAgente(
             }
             // 5. Laberinto normal
             else {
-                char simbolo = laberinto_->getCasilla(i, j).ImprimirCasilla();
+                char simbolo = fila[j].ImprimirCasilla();
                 os << simbolo;
             }
             
@@ -518,7 +893,7 @@ std::vector<std::pair<size_t, size_t>> BusquedaInformada::ReconstruirCamino(
     
     size_t fila = static_cast<size_t>(actual.first);
     size_t col = static_cast<size_t>(actual.second);
-    actual = matriz_costes_[fila][col].padre;
+    actual = matriz_costes_.padre({fila, col});
   }
   
   // Invertir (está desde meta a inicio)
@@ -536,11 +911,13 @@ std::vector<std::pair<size_t, size_t>> BusquedaInformada::ReconstruirCamino(
  * @param nodos_insp Total acumulado de nodos inspeccionados
  * @param camino Vector con el camino real seguido por el agente
  * @param exito true si llegó a la meta, false si abortó
+ * @param metricas_adicionales Métricas propias del modo ejecutado (nombre y valor)
  */
 void BusquedaInformada::ImprimirResumenFinal(std::ostream& os, size_t iteraciones, size_t pasos,
                                              size_t nodos_gen, size_t nodos_insp, double coste,
                                              const std::vector<std::pair<size_t, size_t>>& camino,
-                                             bool exito) const {
+                                             bool exito,
+                                             const std::vector<std::pair<std::string, size_t>>& metricas_adicionales) const {
   os << "========================================\n";
   os << "RESUMEN FINAL\n";
   os << "========================================\n\n";
@@ -551,7 +928,11 @@ void BusquedaInformada::ImprimirResumenFinal(std::ostream& os, size_t iteracione
   os << "  - Total de iteraciones: " << iteraciones << "\n";
   os << "  - Pasos realizados por el agente: " << pasos << "\n";
   os << "  - Total nodos generados (acumulado): " << nodos_gen << "\n";
-  os << "  - Total nodos inspeccionados (acumulado): " << nodos_insp << "\n\n";
+  os << "  - Total nodos inspeccionados (acumulado): " << nodos_insp << "\n";
+  for (const auto& [nombre, valor] : metricas_adicionales) {
+    os << "  - " << nombre << ": " << valor << "\n";
+  }
+  os << "\n";
 
   if (exito && !camino.empty()) {
     os << "Camino real seguido por el agente (" << camino.size() << " posiciones):\n";
@@ -569,14 +950,155 @@ void BusquedaInformada::ImprimirResumenFinal(std::ostream& os, size_t iteracione
 }
 
 /**
- * @brief Inicializa la matriz de costes con valores por defecto
+ * @brief Cambia cuándo repiten A* las búsquedas dinámicas
+ * @param politica Nueva política de replanificación
+ * @throws std::invalid_argument Si el umbral de mejora no está en [0, 1]
  */
-void BusquedaInformada::InicializarMatrizCostes() {
-  size_t filas = laberinto_->filas();
-  size_t cols = laberinto_->columnas();
-  
-  matriz_costes_.clear();
-  matriz_costes_.resize(filas, std::vector<nodo>(cols));
+void BusquedaInformada::set_politica_replanificacion(const PoliticaReplanificacion& politica) {
+  if (politica.umbral_mejora && !(*politica.umbral_mejora >= 0.0 && *politica.umbral_mejora <= 1.0)) {
+    throw std::invalid_argument("El umbral de mejora debe estar entre 0 y 1.");
+  }
+  politica_replanificacion_ = politica;
+}
+
+/**
+ * @brief Fija el peso ε de la heurística en las búsquedas A*
+ * @param epsilon Peso (1 = A* normal)
+ * @throws std::invalid_argument Si ε no es un número finito mayor o igual que 1
+ */
+void BusquedaInformada::set_epsilon(double epsilon) {
+  if (!std::isfinite(epsilon) || epsilon < 1.0) {
+    throw std::invalid_argument("El peso epsilon debe ser un número mayor o igual que 1.");
+  }
+  epsilon_ = epsilon;
+}
+
+/**
+ * @brief Fija los parámetros de ARA*
+ * @param parametros ε inicial, paso de ε y presupuesto en milisegundos
+ * @throws std::invalid_argument Si ε inicial < 1, el paso no es positivo o el presupuesto
+ *         no está entre 0 y un día
+ */
+void BusquedaInformada::set_parametros_ara(const ParametrosARA& parametros) {
+  if (!std::isfinite(parametros.epsilon_inicial) || parametros.epsilon_inicial < 1.0) {
+    throw std::invalid_argument("El epsilon inicial de ARA* debe ser mayor o igual que 1.");
+  }
+  if (!(parametros.paso_epsilon > 0.0)) {
+    throw std::invalid_argument("El paso de epsilon de ARA* debe ser positivo.");
+  }
+  // Un día basta de sobra y mantiene el instante límite dentro del rango del reloj
+  constexpr double kMaxPresupuestoMs = 24.0 * 60.0 * 60.0 * 1000.0;
+  if (!(parametros.presupuesto_ms >= 0.0 && parametros.presupuesto_ms <= kMaxPresupuestoMs)) {
+    throw std::invalid_argument("El presupuesto de ARA* debe estar entre 0 y 86400000 ms.");
+  }
+  parametros_ara_ = parametros;
+}
+
+/**
+ * @brief Decide tras un paso de dinamismo si la búsqueda dinámica debe repetir A*
+ * @param liberadas Casillas que han pasado a libres desde la última planificación (se amplía)
+ * @return true si hay que replanificar
+ *
+ * Con la política por defecto siempre se replanifica. Con solo_si_bloqueado se
+ * reutiliza el camino restante mientras siga siendo válido y, si hay umbral de
+ * mejora, mientras ninguna casilla liberada pueda abrir un atajo que lo supere.
+ */
+bool BusquedaInformada::DebeReplanificar(std::vector<std::pair<size_t, size_t>>& liberadas) const {
+  if (!politica_replanificacion_.solo_si_bloqueado) {
+    return true;
+  }
+  bool hay_nuevos_obstaculos = false;
+  for (const auto& cambio : laberinto_->cambios_dinamismo()) {
+    if (cambio.anterior == Tipo_Casilla::Obstaculo) {
+      liberadas.push_back(cambio.posicion);
+    } else {
+      hay_nuevos_obstaculos = true;
+    }
+  }
+  // Solo un obstáculo nuevo puede invalidar un movimiento del camino
+  if (hay_nuevos_obstaculos && CaminoRestanteBloqueado()) {
+    return true;
+  }
+  return politica_replanificacion_.umbral_mejora &&
+         AtajoPuedeMejorar(liberadas, *politica_replanificacion_.umbral_mejora);
+}
+
+/**
+ * @brief Deja en camino_encontrado_ solo el camino restante y vuelve a poner el cursor a 0
+ * @note Un único borrado al terminar el entorno dinámico en lugar de uno por paso
+ */
+void BusquedaInformada::DescartarPasosDados() {
+  camino_encontrado_.erase(camino_encontrado_.begin(),
+                           camino_encontrado_.begin() + static_cast<std::ptrdiff_t>(paso_camino_));
+  paso_camino_ = 0;
+}
+
+/**
+ * @brief Comprueba si algún movimiento del camino restante ha dejado de ser legal
+ * @return true si el camino está bloqueado
+ * @note CaminoRestante()[0] es la posición actual del agente
+ */
+bool BusquedaInformada::CaminoRestanteBloqueado() const {
+  const std::span<const std::pair<size_t, size_t>> camino_restante = CaminoRestante();
+  for (size_t i = 1; i < camino_restante.size(); ++i) {
+    const auto& [fila_origen, col_origen] = camino_restante[i - 1];
+    const auto& [fila_destino, col_destino] = camino_restante[i];
+    if (laberinto_->MoveCost(fila_origen, col_origen, fila_destino, col_destino) ==
+        std::numeric_limits<double>::infinity()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Comprueba si las casillas liberadas podrían abaratar el camino restante más que el umbral
+ * @param liberadas Casillas que han pasado a libres desde la última planificación
+ * @param umbral Mejora relativa mínima (0.1 = un 10 % del coste restante)
+ * @return true si algún atajo podría mejorar el coste más que el umbral
+ *
+ * Un camino que aproveche una casilla liberada pasa por ella o, si la usa como
+ * esquina de un diagonal, por una de sus vecinas ortogonales. Para cada una de
+ * esas casillas, octile(agente, casilla) + octile(casilla, salida) es una cota
+ * inferior del coste de ese camino. Si ninguna cota baja de
+ * (1 - umbral) * coste restante, replanificar no puede mejorar más que el umbral.
+ */
+bool BusquedaInformada::AtajoPuedeMejorar(const std::vector<std::pair<size_t, size_t>>& liberadas,
+                                          double umbral) const {
+  const std::span<const std::pair<size_t, size_t>> camino_restante = CaminoRestante();
+  if (liberadas.empty() || camino_restante.empty()) {
+    return false;
+  }
+  const std::pair<size_t, size_t> agente = camino_restante.front();
+  const double objetivo = (1.0 - umbral) * laberinto_->CalcularCosteCamino(camino_restante);
+  const DistanciaOctile octile_salida{*laberinto_};
+  const std::array<std::pair<int, int>, 5> desplazamientos{{{0, 0}, {-1, 0}, {1, 0}, {0, -1}, {0, 1}}};
+  for (const auto& [fila, col] : liberadas) {
+    for (const auto& [df, dc] : desplazamientos) {
+      const long f = static_cast<long>(fila) + df;
+      const long c = static_cast<long>(col) + dc;
+      if (f < 0 || c < 0 || f >= laberinto_->filas() || c >= laberinto_->columnas()) {
+        continue;
+      }
+      const std::pair<size_t, size_t> casilla{static_cast<size_t>(f), static_cast<size_t>(c)};
+      const double cota = DistanciaOctileEntre(agente, casilla) + octile_salida(casilla.first, casilla.second);
+      if (cota < objetivo) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Contadores de replanificación para el resumen final (vacío con la política por defecto)
+ */
+std::vector<std::pair<std::string, size_t>> BusquedaInformada::MetricasReplanificacion() const {
+  if (!politica_replanificacion_.solo_si_bloqueado) {
+    return {};
+  }
+  return {{"Replanificaciones con A*", replanificaciones_},
+          {"Replanificaciones evitadas", replanificaciones_evitadas_}};
 }
 
 /**
@@ -585,11 +1107,12 @@ void BusquedaInformada::InicializarMatrizCostes() {
  * @param Abiertos Lista de nodos generados
  * @param Cerrados Lista de nodos inspeccionados
  */
-void BusquedaInformada::ImprimirNodosGeneradosEInspeccionados(std::ostream& os, const std::vector<nodo>& Abiertos, 
-                                                              const std::set<std::pair<size_t, size_t>>& Cerrados) const {
+void BusquedaInformada::ImprimirNodosGeneradosEInspeccionados(std::ostream& os, const ListaAbiertos& Abiertos, 
+                                                              const ListaCerrados& Cerrados) const {
+  const std::vector<std::pair<size_t, size_t>> cerrados_en_orden = Cerrados.EnOrden();
   os << "Lista nodos generados: \n";
   int it{};
-  for (const auto& nodo : Cerrados) {
+  for (const auto& nodo : cerrados_en_orden) {
     ++it;
     os << '(' << nodo.first << ',' << nodo.second << ") ";
     if (it == 12) {
@@ -597,7 +1120,7 @@ void BusquedaInformada::ImprimirNodosGeneradosEInspeccionados(std::ostream& os,
       os << "\n";
     }
   }
-  for (const auto& nodo : Abiertos) {
+  for (const auto& nodo : Abiertos.EnOrdenDeInsercion()) {
     os << '(' << nodo.posicion.first << ',' << nodo.posicion.second << ") ";
     ++it;
     if (it == 12) {
@@ -607,7 +1130,7 @@ void BusquedaInformada::ImprimirNodosGeneradosEInspeccionados(std::ostream& os,
   }
   it = 0;
   os << "\nLista nodos inspeccionados: \n";
-  for (const auto& nodo : Cerrados) {
+  for (const auto& nodo : cerrados_en_orden) {
     ++it;
     os << '(' << nodo.first << ',' << nodo.second << ") ";
     if (it == 12) {
@@ -617,286 +1140,3 @@ void BusquedaInformada::ImprimirNodosGeneradosEInspeccionados(std::ostream& os,
   }
   os << "\n\n";
 }
-
-//============================================================================
-// MÉTODOS PRINCIPALES DE BÚSQUEDA CON OCTILE
-//============================================================================
-
-
-/**
- * @brief Ejecuta búsqueda A* desde una posición inicial dada
- * @param inicio Coordenadas (fila, columna) del punto de partida
- * @return true si se encontró un camino hasta la salida, false en caso contrario
- * @note Resetea estadísticas en cada ejecución
- * @see ReconstruirCamino, InicializarMatrizCostes
- */
-bool BusquedaInformada::BusquedaAStarH2(const std::pair<size_t, size_t>& inicio) {
-  nodos_generados_ = 0;
-  nodos_inspeccionados_ = 0;
-  camino_encontrado_.clear();
-
-  InicializarMatrizCostes();
-
-  std::pair<size_t, size_t> pos_actual = inicio;
-  double g_cost = 0; 
-  double h_cost = laberinto_->HeuristicaOctile(pos_actual.first, pos_actual.second);
-  
-  nodo S(pos_actual, g_cost, h_cost, {-1, -1});
-  std::cerr << "Nodo inicial: " << S;
-  matriz_costes_[pos_actual.first][pos_actual.second] = S;
-  A_.push_back(S);
-  ++nodos_generados_;
-
-  // Paso 2: Repetir mientras A no esté vacía
-  while (!A_.empty()) {
-    // Paso 2(a): Seleccionar el nodo de menor coste f(n)
-    auto it_mejor = A_.begin();
-    for (auto it = A_.begin(); it != A_.end(); ++it) {
-      if (it->f_cost < it_mejor->f_cost) {
-        it_mejor = it;
-      }
-    }
-    nodo actual = *it_mejor;
-    A_.erase(it_mejor);
-    
-    // Insertarlo en la lista de nodos cerrados C
-    C_.insert(actual.posicion);
-    ++nodos_inspeccionados_;
-    std::cerr << "Procesando nodo: " << actual;
-    
-    // Verificar si llegamos a la salida
-    if (actual.posicion == laberinto_->coordenadas_exit()) {
-      std::cerr << "¡Camino encontrado!" << std::endl;
-      camino_encontrado_ = ReconstruirCamino(actual.posicion);
-      return true;
-    }
-    
-    // Paso 2(b): Para cada nodo vecino
-    std::vector<std::pair<size_t, size_t>> vecinos = 
-        laberinto_->GetVecinosCasilla(actual.posicion.first, actual.posicion.second);
-    
-    for (const auto& vecino_pos : vecinos) {
-      size_t vecino_fila = vecino_pos.first;
-      size_t vecino_col = vecino_pos.second;
-      
-      // Calcular costes para el vecino
-      double move_cost = laberinto_->MoveCost(actual.posicion.first, actual.posicion.second, 
-                                             vecino_fila, vecino_col);
-      double g_cost_vecino = actual.g_cost + move_cost;
-      double h_cost_vecino = laberinto_->HeuristicaOctile(vecino_fila, vecino_col);
-      
-      nodo vecino(vecino_pos, g_cost_vecino, h_cost_vecino, 
-                 {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)});
-      
-      // Verificar si el nodo está en C (cerrados)
-      bool en_C = (C_.find(vecino_pos) != C_.end());
-
-      // Verificar si el nodo está en A (abiertos)
-      bool en_A = false;
-      auto it_en_A = A_.end();
-      for (auto it = A_.begin(); it != A_.end(); ++it) {
-        if (it->posicion == vecino_pos) {
-          en_A = true;
-          it_en_A = it;
-          break;
-        }
-      }
-      
-      // Paso 2(b)i: Si el nodo no está ni en A ni en C
-      if (!en_A && !en_C) {
-        vecino.padre = {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)};
-        matriz_costes_[vecino_fila][vecino_col] = vecino;
-        A_.push_back(vecino);
-        ++nodos_generados_;
-        std::cerr << "  Nuevo nodo añadido a A: " << vecino;
-      }
-      // Paso 2(b)ii: Si el nodo está en A
-      else if (en_A) {
-        // Verificar si encontramos un camino mejor (menor g_cost)
-        if (g_cost_vecino < it_en_A->g_cost) {
-          std::cerr << "  Actualizando nodo en A: g_cost mejorado de " 
-                    << it_en_A->g_cost << " a " << g_cost_vecino << std::endl;
-          
-          // Actualizar coste g(n) y por lo tanto f(n)
-          it_en_A->g_cost = g_cost_vecino;
-          it_en_A->f_cost = g_cost_vecino + it_en_A->h_cost;
-          it_en_A->padre = {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)};
-          
-          // Actualizar también en la matriz de costes
-          matriz_costes_[vecino_fila][vecino_col] = *it_en_A;
-        }
-      }
-      // Si el nodo está en C, no hacemos nada (ya fue procesado)
-    }
-  }
-  
-  // Paso 3: Si A está vacía y no se llegó a la salida
-  std::cout << "No existe camino desde la entrada hasta la salida." << std::endl;
-  return false;
-}
-
-/**
- * @brief Ejecuta búsqueda A* en entorno dinámico
- * @param output_file Fichero de salida donde se guarda la memoria
- * @return true si el agente llegó a la meta, false si no es posible
- * Simula un agente navegando en un entorno que cambia dinámicamente:
- * Algoritmo:
- * 1. Posición actual = entrada
- * 2. Mientras no llegue a la meta:
- *    a. Planificar camino con A* desde posición actual
- *    b. Si no hay camino, reintentar hasta MAX_REINTENTOS
- *    c. Dar un paso siguiendo el camino planificado
- *    d. Actualizar entorno (aplicar dinamismo)
- *    e. Repetir
- * 3. Generar reporte completo con todas las iteraciones
- * 
- * Genera archivo "salida_dinamica.txt" con:
- * - Estado del laberinto en cada iteración
- * - Visualización con agente (@), camino planificado (*) y recorrido (·)
- * - Estadísticas acumuladas
- * - Resumen final con camino real seguido
- * 
- * @note Máximo 5 reintentos consecutivos sin camino antes de abortar
- * @see ActualizarDinamismo, ImprimirLaberintoConCaminoYAgente
- */
-bool BusquedaInformada::BusquedaAStarDinamicaH2(const std::string& output_file) {
-  if (!laberinto_) {
-    std::cerr << "Error: Laberinto no configurado.\n";
-    return false;
-  }
-
-  std::ofstream archivo_salida(output_file);
-  if (!archivo_salida.is_open()) {
-    std::cerr << "Error: No se pudo crear salida_dinamica.txt\n";
-    return false;
-  }
-
-  auto start_pos = laberinto_->coordenadas_start();
-  auto exit_pos = laberinto_->coordenadas_exit();
-  std::pair<size_t, size_t> posicion_actual = start_pos;
-
-  size_t iteracion = 0;
-  size_t pasos_totales = 0;
-  size_t nodos_generados_acumulados = 0;
-  size_t nodos_inspeccionados_acumulados = 0;
-  size_t reintentos_sin_exito_consecutivos = 0;
-  const size_t MAX_REINTENTOS = 5;
-
-  std::vector<std::pair<size_t, size_t>> camino_real_seguido;
-  camino_real_seguido.push_back(posicion_actual);
-
-  std::cerr << "\n=== INICIANDO BÚSQUEDA A* DINÁMICA ===\n";
-  std::cerr << "Inicio: (" << posicion_actual.first << "," << posicion_actual.second << ")\n";
-  std::cerr << "Meta: (" << exit_pos.first << "," << exit_pos.second << ")\n\n";
-
-  while (posicion_actual != exit_pos) {
-    ++iteracion;
-
-    archivo_salida << "----------------------------------------\n";
-    archivo_salida << "ITERACIÓN " << iteracion << "\n";
-    archivo_salida << "----------------------------------------\n";
-    archivo_salida << "Posición actual del agente: (" 
-                   << posicion_actual.first << "," << posicion_actual.second << ")\n\n";
-
-    std::cerr << "Iteración " << iteracion << ": Ejecutando A* desde (" 
-              << posicion_actual.first << "," << posicion_actual.second << ")...\n";
-
-    A_.clear();
-    C_.clear();
-    bool camino_encontrado = BusquedaAStarH2(posicion_actual);
-
-    if (camino_encontrado) {
-      reintentos_sin_exito_consecutivos = 0;
-
-      // CAMBIO AQUÍ: Usar el nuevo método con agente y camino histórico
-      archivo_salida << "Laberinto con camino planificado:\n";
-      archivo_salida << "Símbolos: @ = Agente | * = Camino planificado | · = Pasos dados | E = Meta\n\n";
-      ImprimirLaberintoConCaminoYAgente(archivo_salida, posicion_actual, camino_real_seguido);
-      archivo_salida << "\n";
-
-      nodos_generados_acumulados += nodos_generados_;
-      nodos_inspeccionados_acumulados += nodos_inspeccionados_;
-
-      archivo_salida << "Camino planificado (longitud " << camino_encontrado_.size() << "):\n";
-      for (const auto& [f, c] : camino_encontrado_) {
-        archivo_salida << "(" << f << "," << c << ") ";
-      }
-      archivo_salida << "\n\n";
-
-      if (!camino_encontrado_.empty()) {
-        auto [exit_f, exit_c] = laberinto_->coordenadas_exit();
-        double coste_camino_planificado = matriz_costes_[exit_f][exit_c].g_cost;
-        archivo_salida << "Coste del camino planificado: " << coste_camino_planificado << "\n\n";
-      }
-
-      archivo_salida << "Estadísticas de esta planificación:\n";
-      archivo_salida << "  - Nodos generados: " << nodos_generados_ << "\n";
-      archivo_salida << "  - Nodos inspeccionados: " << nodos_inspeccionados_ << "\n\n";
-      // Mostrar listas de nodos inspeccionados y generados
-      ImprimirNodosGeneradosEInspeccionados(archivo_salida, A_, C_);  
-      if (camino_encontrado_.size() >= 2) {
-        posicion_actual = camino_encontrado_[1];
-        camino_real_seguido.push_back(posicion_actual);
-        ++pasos_totales;
-
-        archivo_salida << "Agente avanza a: (" 
-                       << posicion_actual.first << "," << posicion_actual.second << ")\n\n";
-        
-        std::cerr << " Avanzó a (" << posicion_actual.first << "," 
-                  << posicion_actual.second << ")\n";
-
-        if (posicion_actual == exit_pos) {
-          archivo_salida << "*** ¡AGENTE LLEGÓ A LA META! ***\n\n";
-          std::cerr << "\n¡ÉXITO! El agente llegó a la meta.\n";
-          break;
-        }
-
-        archivo_salida << "Actualizando entorno dinámico...\n\n";
-        laberinto_->ActualizarDinamismo();
-        
-      } else {
-        archivo_salida << "*** ¡AGENTE YA ESTÁ EN LA META! ***\n\n";
-        break;
-      }
-
-    } else {
-      archivo_salida << "*** NO SE ENCONTRÓ CAMINO EN ESTA ITERACIÓN ***\n";
-      archivo_salida << "Reintento " << (reintentos_sin_exito_consecutivos + 1) 
-                     << " de " << MAX_REINTENTOS << "\n\n";
-      
-      std::cerr << "  No hay camino. Reintento " << (reintentos_sin_exito_consecutivos + 1) 
-                << "/" << MAX_REINTENTOS << "\n";
-
-      ++reintentos_sin_exito_consecutivos;
-
-      if (reintentos_sin_exito_consecutivos >= MAX_REINTENTOS) {
-        archivo_salida << "*** MÁXIMO DE REINTENTOS ALCANZADO ***\n";
-        archivo_salida << "*** NO ES POSIBLE LLEGAR AL DESTINO ***\n\n";
-        
-        std::cerr << "\nFALLO: No se pudo llegar al destino tras " 
-                  << MAX_REINTENTOS << " reintentos.\n";
-        
-        double coste_final = laberinto_->CalcularCosteCamino(camino_real_seguido);
-
-        ImprimirResumenFinal(archivo_salida, iteracion, pasos_totales, 
-                           nodos_generados_acumulados, nodos_inspeccionados_acumulados, coste_final,
-                           camino_real_seguido, false);
-        archivo_salida.close();
-        return false;
-      }
-
-      archivo_salida << "Actualizando entorno para reintentar...\n\n";
-      laberinto_->ActualizarDinamismo();
-    }
-  }
-
-  double coste_final = laberinto_->CalcularCosteCamino(camino_real_seguido);
-
-  ImprimirResumenFinal(archivo_salida, iteracion, pasos_totales, 
-                      nodos_generados_acumulados, nodos_inspeccionados_acumulados, coste_final,
-                      camino_real_seguido, true);
-
-  archivo_salida.close();
-  std::cerr << "\nResultados guardados en: " << output_file << "\n";
-  return true;
-}
\ No newline at end of file
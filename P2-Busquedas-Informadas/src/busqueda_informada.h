@@ -20,45 +20,42 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <optional>
+#include <functional>
+#include <span>
 #include "laberinto.h"
+#include "nodo.h"
+#include "lista_abiertos.h"
+#include "lista_cerrados.h"
+#include "matriz_costes.h"
+#include "heuristicas.h"
+#include "tabla_saltos.h"
+#include "ara_star.h"
 
 /**
- * @struct nodo
- * @brief Representa un nodo en el árbol de búsqueda A*
- * 
- * Estructura que almacena toda la información necesaria para un nodo
- * durante la ejecución del algoritmo A*:
- * - Posición en el laberinto
- * - Costes g(n), h(n) y f(n)
- * - Referencia al nodo padre para reconstrucción del camino
- * 
- * La función de evaluación es: f(n) = g(n) + h(n)
- * donde:
- * - g(n) = coste acumulado desde el inicio hasta n
- * - h(n) = estimación heurística del coste de n hasta la meta
- * - f(n) = estimación del coste total del camino pasando por n
+ * @brief Nivel de traza por std::cerr de las búsquedas (cada nivel incluye a los anteriores)
+ *  - kNinguno: sin traza, solo los resultados
+ *  - kResumen: nodo inicial, camino encontrado e inicio/fin de la búsqueda dinámica
+ *  - kIteracion: cada nodo expandido y cada iteración de la búsqueda dinámica
+ *  - kVecino: cada vecino añadido o mejorado en A
  */
-typedef struct nodo {
-  std::pair<size_t, size_t> posicion{};
-  double g_cost{}, h_cost{}, f_cost{};
-  std::pair<int, int> padre{-1, -1};
-  // Metodos
-  nodo() = default;
-  nodo(std::pair<size_t, size_t> pos, double g, double h, std::pair<int, int> p) 
-                : posicion{pos}, g_cost{g}, h_cost{h}, f_cost{g + h}, padre(p) {}
-  // Operador < necesario para std::set
-  bool operator<(const nodo& other) const {
-    if (posicion.first != other.posicion.first) {
-      return posicion.first < other.posicion.first;
-    }
-    return posicion.second < other.posicion.second;
-  }
-  friend std::ostream& operator<<(std::ostream& os, const nodo& n) {
-    os << "pos=(" << n.posicion.first << "," << n.posicion.second << ") "
-       << "g=" << n.g_cost << " h=" << n.h_cost << " f=" << n.f_cost << "\n";
-    return os;
-  }
-} nodo;
+enum class NivelTraza { kNinguno, kResumen, kIteracion, kVecino };
+
+/**
+ * @struct PoliticaReplanificacion
+ * @brief Cuándo repiten A* las búsquedas dinámicas tras cada paso del agente
+ */
+struct PoliticaReplanificacion {
+  bool solo_si_bloqueado{false};         // false: replanifica en cada paso
+  std::optional<double> umbral_mejora{};  // Replanifica también si un atajo puede ahorrar más de esta fracción
+};
+
+/**
+ * @brief Variante de Jump Point Search
+ *  - kJPS: los saltos rectos recorren la recta casilla a casilla
+ *  - kJPSPlus: los saltos rectos se leen de una TablaSaltos precalculada
+ */
+enum class ModoJPS { kJPS, kJPSPlus };
 
 /**
  * @class BusquedaInformada
@@ -69,6 +66,15 @@ typedef struct nodo {
  * 1. **A* Estático**: Búsqueda única en un laberinto sin cambios
  * 2. **A* Dinámico**: Búsqueda iterativa donde el entorno cambia después
  *                     de cada paso del agente
+ * 3. **D* Lite Dinámico**: Igual que el anterior, pero reparando el plan de
+ *                          forma incremental en lugar de repetir A* (ver DStarLite)
+ * 4. **JPS / JPS+**: A* octile que solo expande puntos de salto; el camino
+ *                    devuelto tiene todas las casillas, igual que el de A*
+ * 5. **ARA***: A* ponderado anytime que mejora el camino mientras quede
+ *              presupuesto de tiempo e informa de la cota alcanzada (ver AraStar)
+ *
+ * Las opciones de A* admiten un peso ε >= 1 sobre la heurística (A* ponderado):
+ * con una heurística admisible el coste queda como mucho ε veces el óptimo.
  */
 class BusquedaInformada {
  public:
@@ -76,18 +82,45 @@ class BusquedaInformada {
   BusquedaInformada(Laberinto& laberinto) : laberinto_{&laberinto} {}
   BusquedaInformada(const BusquedaInformada&) = delete;
   BusquedaInformada& operator=(const BusquedaInformada&) = delete;
-  //Metodo de busqueda A* con manhattan
-  bool BusquedaAStar(const std::pair<size_t, size_t>&);
-  bool BusquedaAStarDinamica(const std::string&);
-  //Metodo de busqueda A* con oricle
-  bool BusquedaAStarH2(const std::pair<size_t, size_t>&);
-  bool BusquedaAStarDinamicaH2(const std::string&);
+  //Metodo de busqueda A* con la heurística elegida (manhattan por defecto)
+  bool BusquedaAStar(const std::pair<size_t, size_t>&, TipoHeuristica = TipoHeuristica::kManhattan);
+  bool BusquedaAStarDinamica(const std::string&, TipoHeuristica = TipoHeuristica::kManhattan);
+  //Metodo de busqueda A* con octile
+  bool BusquedaAStarH2(const std::pair<size_t, size_t>& inicio) { return BusquedaAStar(inicio, TipoHeuristica::kOctile); }
+  bool BusquedaAStarDinamicaH2(const std::string& output_file) {
+    return BusquedaAStarDinamica(output_file, TipoHeuristica::kOctile);
+  }
+  //A* genérico sobre el functor de la heurística y la política de coste
+  template <typename Heuristica, typename Coste = CosteVecino>
+  bool BusquedaAStarGenerica(const std::pair<size_t, size_t>&, const Heuristica&, const Coste& coste = {});
+  //Replanificación incremental con D* Lite en el entorno dinámico
+  bool BusquedaDStarLiteDinamica(const std::string&);
+  //Jump Point Search (octile) en el entorno estático y en el dinámico
+  bool BusquedaJPS(const std::pair<size_t, size_t>&, ModoJPS = ModoJPS::kJPS);
+  bool BusquedaJPSDinamica(const std::string&, ModoJPS = ModoJPS::kJPSPlus);
+  //A* anytime (ARA*) con los parámetros de set_parametros_ara
+  bool BusquedaARAStar(const std::pair<size_t, size_t>&);
+  bool BusquedaARAStarDinamica(const std::string&);
   // Google style getters
   const std::vector<std::pair<size_t, size_t>>& camino_encontrado() const { 
     return camino_encontrado_; 
   }
   size_t nodos_generados() const { return nodos_generados_; }
   size_t nodos_inspeccionados() const { return nodos_inspeccionados_; }
+  NivelTraza nivel_traza() const noexcept { return nivel_traza_; }
+  TipoHeuristica heuristica() const noexcept { return heuristica_; }
+  const PoliticaReplanificacion& politica_replanificacion() const noexcept { return politica_replanificacion_; }
+  size_t replanificaciones() const noexcept { return replanificaciones_; }
+  size_t replanificaciones_evitadas() const noexcept { return replanificaciones_evitadas_; }
+  double epsilon() const noexcept { return epsilon_; }
+  const ParametrosARA& parametros_ara() const noexcept { return parametros_ara_; }
+  const std::vector<SolucionARA>& soluciones_ara() const noexcept { return soluciones_ara_; }
+  // Setters
+  void set_nivel_traza(NivelTraza nivel) noexcept { nivel_traza_ = nivel; }
+  void set_heuristica(TipoHeuristica heuristica) noexcept { heuristica_ = heuristica; }
+  void set_politica_replanificacion(const PoliticaReplanificacion&);
+  void set_epsilon(double);
+  void set_parametros_ara(const ParametrosARA&);
   // Impresión
   void ImprimirLaberintoConCaminoYAgente(std::ostream&, const std::pair<size_t, size_t>&,
                                           const std::vector<std::pair<size_t, size_t>>& camino_historico = {}
@@ -98,19 +131,176 @@ class BusquedaInformada {
  private:
   Laberinto* laberinto_{};
   std::vector<std::pair<size_t, size_t>> camino_encontrado_{};
+  // En el entorno dinámico el agente está en camino_encontrado_[paso_camino_]; avanzar
+  // solo mueve el cursor. Fuera de EjecutarEntornoDinamico vale siempre 0
+  size_t paso_camino_{};
   size_t nodos_generados_{};
   size_t nodos_inspeccionados_{};
-  std::vector<nodo> A_{};
-  std::set<std::pair<size_t, size_t>> C_{};
-  std::vector<std::vector<nodo>> matriz_costes_{};
+  NivelTraza nivel_traza_{NivelTraza::kVecino};
+  // Heurística de las opciones de A* que no fijan una (elegida con --heuristica)
+  TipoHeuristica heuristica_{TipoHeuristica::kManhattan};
+  // Peso de la heurística en las búsquedas A* (1 = A* normal)
+  double epsilon_{1.0};
+  ParametrosARA parametros_ara_{};
+  std::vector<SolucionARA> soluciones_ara_{};
+  PoliticaReplanificacion politica_replanificacion_{};
+  size_t replanificaciones_{};
+  size_t replanificaciones_evitadas_{};
+  ListaAbiertos A_{};
+  ListaCerrados C_{};
+  MatrizCostes matriz_costes_{};
+  // Saltos rectos de JPS+; se sincroniza con el laberinto al empezar cada búsqueda
+  TablaSaltos tabla_saltos_{};
   
   // Metodos auxiliares
-  void InicializarMatrizCostes();
+  bool Trazar(NivelTraza nivel) const noexcept { return nivel_traza_ >= nivel; }
+  std::span<const std::pair<size_t, size_t>> CaminoRestante() const noexcept {
+    return std::span<const std::pair<size_t, size_t>>{camino_encontrado_}.subspan(paso_camino_);
+  }
+  void DescartarPasosDados();
+  // Planificador que se enchufa en EjecutarEntornoDinamico. Solo planificar es obligatorio:
+  //  - planificar: búsqueda desde la posición del agente
+  //  - tras_dinamismo: tras cada ActualizarDinamismo, con la posición del agente
+  //    (D* Lite mueve ahí su inicio, actualiza km y aplica cambios_dinamismo())
+  //  - metricas: contadores propios de la última planificación (false) o acumulados (true)
+  struct PlanificadorDinamico {
+    std::function<bool(const std::pair<size_t, size_t>&)> planificar{};
+    std::function<void(const std::pair<size_t, size_t>&)> tras_dinamismo{};
+    std::function<std::vector<std::pair<std::string, size_t>>(bool)> metricas{};
+  };
+  bool EjecutarEntornoDinamico(const std::string&, const std::string&, const PlanificadorDinamico&);
+  void FijarCostesCamino();
   std::vector<std::pair<size_t, size_t>> ReconstruirCamino(const std::pair<size_t, size_t>&);
   void ImprimirResumenFinal(std::ostream&, size_t, size_t, size_t, size_t, double,
                             const std::vector<std::pair<size_t, size_t>>&, 
-                            bool) const;
-  void ImprimirNodosGeneradosEInspeccionados(std::ostream&, const std::vector<nodo>&, const std::set<std::pair<size_t, size_t>>&) const;
+                            bool, const std::vector<std::pair<std::string, size_t>>& metricas_adicionales = {}) const;
+  bool DebeReplanificar(std::vector<std::pair<size_t, size_t>>&) const;
+  bool CaminoRestanteBloqueado() const;
+  bool AtajoPuedeMejorar(const std::vector<std::pair<size_t, size_t>>&, double) const;
+  std::vector<std::pair<std::string, size_t>> MetricasReplanificacion() const;
+  void ImprimirNodosGeneradosEInspeccionados(std::ostream&, const ListaAbiertos&, const ListaCerrados&) const;
 };
 
-#endif
\ No newline at end of file
+//============================================================================
+// A* GENÉRICO (plantilla)
+//============================================================================
+
+/**
+ * @brief Búsqueda A* desde una posición inicial con una heurística y una política de coste dadas
+ * @tparam Heuristica Functor double(fila, columna) que estima el coste hasta la salida
+ * @tparam Coste Functor double(const Vecino&) con el coste de cada movimiento
+ * @param inicio Coordenadas (fila, columna) del punto de partida
+ * @param heuristica Heurística (ver heuristicas.h)
+ * @param coste Política de coste de los movimientos (por defecto la del Vecindario)
+ * @return true si se encontró un camino hasta la salida, false en caso contrario
+ * @note Resetea estadísticas en cada ejecución
+ * @see ReconstruirCamino
+ *
+ * La heurística y el coste son parámetros de plantilla, así que se expanden en
+ * línea en el bucle principal sin llamadas indirectas.
+ */
+template <typename Heuristica, typename Coste>
+bool BusquedaInformada::BusquedaAStarGenerica(const std::pair<size_t, size_t>& inicio,
+                                              const Heuristica& heuristica, const Coste& coste) {
+  nodos_generados_ = 0;
+  nodos_inspeccionados_ = 0;
+  camino_encontrado_.clear();
+
+  matriz_costes_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+  A_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+  C_.Reiniciar(laberinto_->filas(), laberinto_->columnas());
+
+  std::pair<size_t, size_t> pos_actual = inicio;
+  double g_cost = 0; 
+  double h_cost = heuristica(pos_actual.first, pos_actual.second);
+  
+  nodo S(pos_actual, g_cost, h_cost, {-1, -1});
+  if (Trazar(NivelTraza::kResumen)) {
+    std::cerr << "Nodo inicial: " << S;
+  }
+  matriz_costes_.Fijar(S);
+  A_.Insertar(S);
+  ++nodos_generados_;
+
+  // Paso 2: Repetir mientras A no esté vacía
+  while (!A_.empty()) {
+    // Paso 2(a): Seleccionar el nodo de menor coste f(n)
+    nodo actual = A_.ExtraerMejor();
+    
+    // Insertarlo en la lista de nodos cerrados C
+    C_.Insertar(actual.posicion);
+    ++nodos_inspeccionados_;
+    if (Trazar(NivelTraza::kIteracion)) {
+      std::cerr << "Procesando nodo: " << actual;
+    }
+    
+    // Verificar si llegamos a la salida
+    if (actual.posicion == laberinto_->coordenadas_exit()) {
+      if (Trazar(NivelTraza::kResumen)) {
+        std::cerr << "¡Camino encontrado!" << std::endl;
+      }
+      camino_encontrado_ = ReconstruirCamino(actual.posicion);
+      return true;
+    }
+    
+    // Paso 2(b): Para cada nodo vecino
+    const Vecindario vecinos = 
+        laberinto_->GetVecinosCasilla(actual.posicion.first, actual.posicion.second);
+    
+    for (const Vecino& v : vecinos) {
+      const std::pair<size_t, size_t>& vecino_pos = v.posicion;
+      size_t vecino_fila = vecino_pos.first;
+      size_t vecino_col = vecino_pos.second;
+      
+      // Calcular costes para el vecino (coste del movimiento según la política)
+      double move_cost = coste(v);
+      double g_cost_vecino = actual.g_cost + move_cost;
+      double h_cost_vecino = heuristica(vecino_fila, vecino_col);
+      
+      nodo vecino(vecino_pos, g_cost_vecino, h_cost_vecino, 
+                 {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)});
+      
+      // Verificar si el nodo está en C (cerrados)
+      bool en_C = C_.Contiene(vecino_pos);
+
+      // Verificar si el nodo está en A (abiertos)
+      bool en_A = A_.Contiene(vecino_pos);
+      
+      // Paso 2(b)i: Si el nodo no está ni en A ni en C
+      if (!en_A && !en_C) {
+        vecino.padre = {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)};
+        matriz_costes_.Fijar(vecino);
+        A_.Insertar(vecino);
+        ++nodos_generados_;
+        if (Trazar(NivelTraza::kVecino)) {
+          std::cerr << "  Nuevo nodo añadido a A: " << vecino;
+        }
+      }
+      // Paso 2(b)ii: Si el nodo está en A
+      else if (en_A) {
+        // Verificar si encontramos un camino mejor (menor g_cost)
+        const nodo& en_A_actual = A_.Obtener(vecino_pos);
+        if (g_cost_vecino < en_A_actual.g_cost) {
+          if (Trazar(NivelTraza::kVecino)) {
+            std::cerr << "  Actualizando nodo en A: g_cost mejorado de " 
+                      << en_A_actual.g_cost << " a " << g_cost_vecino << std::endl;
+          }
+          
+          // Actualizar coste g(n) y por lo tanto f(n) (decrease-key)
+          A_.MejorarCoste(vecino_pos, g_cost_vecino,
+                          {static_cast<int>(actual.posicion.first), static_cast<int>(actual.posicion.second)});
+          
+          // Actualizar también en la matriz de costes
+          matriz_costes_.Fijar(A_.Obtener(vecino_pos));
+        }
+      }
+      // Si el nodo está en C, no hacemos nada (ya fue procesado)
+    }
+  }
+  
+  // Paso 3: Si A está vacía y no se llegó a la salida
+  std::cout << "No existe camino desde la entrada hasta la salida." << std::endl;
+  return false;
+}
+
+#endif
@@ -15,17 +15,65 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <optional>
+#include <cstdint>
 #include "funciones_cliente.h"
 #include "laberinto.h"
 #include "busqueda_informada.h"
 
 int main(int argc, char* argv[]) {
+  // Modo conversión a instantánea binaria
+  if (argc == 4 && std::string{argv[1]} == "--convertir") {
+    return ConvertirAInstantanea(argv[2], argv[3]);
+  }
+  NivelTraza nivel_traza{NivelTraza::kVecino};
+  if (!ExtraerNivelTraza(argc, argv, nivel_traza)) {
+    return 1;
+  }
+  TipoHeuristica heuristica{TipoHeuristica::kManhattan};
+  if (!ExtraerHeuristica(argc, argv, heuristica)) {
+    return 1;
+  }
+  std::optional<uint32_t> semilla{};
+  ParametrosDinamismo parametros_dinamismo{};
+  if (!ExtraerOpcionesDinamismo(argc, argv, semilla, parametros_dinamismo)) {
+    return 1;
+  }
+  PoliticaReplanificacion politica_replanificacion{};
+  if (!ExtraerPoliticaReplanificacion(argc, argv, politica_replanificacion)) {
+    return 1;
+  }
+  double epsilon{1.0};
+  ParametrosARA parametros_ara{};
+  if (!ExtraerOpcionesPonderacion(argc, argv, epsilon, parametros_ara)) {
+    return 1;
+  }
   if (!CheckCorrectsParameters(argc, argv)) {
     return 1;
   }
   PrintProgramPorpouse();
-  Laberinto laberinto{argv[1]};
+  Laberinto laberinto;
+  try {
+    laberinto.ProcesarLaberinto(argv[1]);
+    laberinto.set_parametros_dinamismo(parametros_dinamismo);
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  if (semilla) {
+    laberinto.set_semilla(*semilla);
+  }
   BusquedaInformada A{laberinto};
+  A.set_nivel_traza(nivel_traza);
+  A.set_heuristica(heuristica);
+  try {
+    A.set_politica_replanificacion(politica_replanificacion);
+    A.set_epsilon(epsilon);
+    A.set_parametros_ara(parametros_ara);
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
   std::string nombre_output{""};
   if (argc == 3) {
     nombre_output = {argv[2]};
@@ -16,10 +16,13 @@
 #ifndef CASILLA_H
 #define CASILLA_H
 
+#include <cstdint>
+
 /**
  * @brief Enumeración de los tipos posibles de casilla en el laberinto
+ * @note Ocupa un byte para que el laberinto sea un buffer compacto de uint8_t
  */
-enum class Tipo_Casilla : int {
+enum class Tipo_Casilla : uint8_t {
   Libre = 0,
   Obstaculo = 1,
   Start = 3,
@@ -51,4 +54,6 @@ class Casilla {
   Tipo_Casilla tipo_{};
 };
 
+static_assert(sizeof(Casilla) == sizeof(uint8_t), "Casilla debe ocupar un byte");
+
 #endif
\ No newline at end of file
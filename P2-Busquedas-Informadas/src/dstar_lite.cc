@@ -0,0 +1,238 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Implementación de la clase DStarLite
+  * @version 1.0
+  */
+
+#include "dstar_lite.h"
+#include <algorithm>
+#include "heuristicas.h"
+
+/**
+ * @brief Reinicia el planificador para ir de inicio a meta en el laberinto actual
+ * @param inicio Casilla en la que está el agente
+ * @param meta Casilla objetivo (raíz de la búsqueda hacia atrás)
+ *
+ * Todas las casillas quedan con g = rhs = ∞ salvo rhs(meta) = 0, que es la
+ * única casilla inconsistente y la única en la cola.
+ */
+void DStarLite::Inicializar(const std::pair<size_t, size_t>& inicio,
+                            const std::pair<size_t, size_t>& meta) {
+  const size_t casillas = static_cast<size_t>(laberinto_->filas()) * laberinto_->columnas();
+  columnas_ = laberinto_->columnas();
+  inicio_ = inicio;
+  meta_ = meta;
+  km_ = 0.0;
+  g_.assign(casillas, kInfinito);
+  rhs_.assign(casillas, kInfinito);
+  clave_en_cola_.assign(casillas, Clave{kInfinito, kInfinito});
+  en_cola_.assign(casillas, false);
+  cola_ = {};
+  rhs_[Indice(meta_)] = 0.0;
+  Encolar(Indice(meta_));
+}
+
+/**
+ * @brief Registra que el agente se ha movido
+ * @param nuevo_inicio Nueva casilla del agente
+ *
+ * Las claves de la cola se calcularon con h respecto al inicio anterior. En
+ * lugar de recalcularlas todas se acumula h(inicio anterior, nuevo inicio) en
+ * km, que es una cota inferior de lo que han bajado.
+ */
+void DStarLite::MoverInicio(const std::pair<size_t, size_t>& nuevo_inicio) {
+  km_ += DistanciaOctileEntre(inicio_, nuevo_inicio);
+  inicio_ = nuevo_inicio;
+}
+
+/**
+ * @brief Incorpora los cambios de un paso de dinamismo
+ * @param cambios Casillas que cambiaron de tipo (Laberinto::cambios_dinamismo())
+ *
+ * Una casilla que cambia altera los movimientos que entran en ella y los
+ * diagonales que la usan como esquina. Ambos parten de sus 8 vecinas, así que
+ * basta recalcular rhs en ellas; la propia casilla no cambia sus salidas.
+ */
+void DStarLite::NotificarCambios(const std::vector<CambioCasilla>& cambios) {
+  const int filas = laberinto_->filas();
+  const int columnas = laberinto_->columnas();
+  for (const auto& cambio : cambios) {
+    const int fila = static_cast<int>(cambio.posicion.first);
+    const int columna = static_cast<int>(cambio.posicion.second);
+    for (int df = -1; df <= 1; ++df) {
+      for (int dc = -1; dc <= 1; ++dc) {
+        const int f = fila + df;
+        const int c = columna + dc;
+        if ((df != 0 || dc != 0) && f >= 0 && f < filas && c >= 0 && c < columnas) {
+          ActualizarVertice(static_cast<size_t>(f) * columnas_ + static_cast<size_t>(c));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Expande casillas hasta que el inicio es consistente y ninguna clave de la cola es menor
+ * @return true si existe camino desde el inicio hasta la meta
+ */
+bool DStarLite::CalcularCaminoMasCorto() {
+  const size_t indice_inicio = Indice(inicio_);
+  DescartarObsoletas();
+  while (!cola_.empty() &&
+         (cola_.top().first < CalcularClave(indice_inicio) || rhs_[indice_inicio] != g_[indice_inicio])) {
+    const auto [clave_antigua, u] = cola_.top();
+    const Clave clave_nueva = CalcularClave(u);
+    if (clave_antigua < clave_nueva) {
+      // Clave calculada con un km anterior: se reinserta con la actual
+      cola_.pop();
+      clave_en_cola_[u] = clave_nueva;
+      cola_.push({clave_nueva, u});
+    } else if (g_[u] > rhs_[u]) {
+      // Sobreconsistente: g baja a rhs y se propaga a los predecesores
+      cola_.pop();
+      en_cola_[u] = false;
+      ++nodos_inspeccionados_;
+      g_[u] = rhs_[u];
+      RecorrerPredecesores(u, [this](size_t s) { ActualizarVertice(s); });
+    } else {
+      // Infraconsistente: g sube a ∞ y se reevalúan u y sus predecesores
+      ++nodos_inspeccionados_;
+      g_[u] = kInfinito;
+      RecorrerPredecesores(u, [this](size_t s) { ActualizarVertice(s); });
+      ActualizarVertice(u);
+    }
+    DescartarObsoletas();
+  }
+  return rhs_[indice_inicio] != kInfinito;
+}
+
+/**
+ * @brief Camino desde el inicio hasta la meta siguiendo el mejor sucesor según g
+ * @return Casillas del camino (vacío si no hay camino)
+ */
+std::vector<std::pair<size_t, size_t>> DStarLite::ExtraerCamino() const {
+  std::vector<std::pair<size_t, size_t>> camino;
+  if (rhs_[Indice(inicio_)] == kInfinito) {
+    return camino;
+  }
+  std::pair<size_t, size_t> actual = inicio_;
+  camino.push_back(actual);
+  // Con g consistente el camino nunca repite casillas; el límite evita ciclos si no lo fuera
+  while (actual != meta_ && camino.size() <= g_.size()) {
+    double mejor_coste = kInfinito;
+    std::pair<size_t, size_t> mejor{};
+    for (const auto& vecino : laberinto_->GetVecinosCasilla(actual.first, actual.second)) {
+      const double coste = vecino.coste + g_[vecino.indice];
+      if (coste < mejor_coste) {
+        mejor_coste = coste;
+        mejor = vecino.posicion;
+      }
+    }
+    if (mejor_coste == kInfinito) {
+      return {};
+    }
+    actual = mejor;
+    camino.push_back(actual);
+  }
+  if (actual != meta_) {
+    return {};
+  }
+  return camino;
+}
+
+//============================================================================
+// MÉTODOS AUXILIARES
+//============================================================================
+
+/**
+ * @brief Clave de prioridad [min(g, rhs) + h(inicio, s) + km ; min(g, rhs)]
+ */
+DStarLite::Clave DStarLite::CalcularClave(size_t indice) const {
+  const double minimo = std::min(g_[indice], rhs_[indice]);
+  return {minimo + DistanciaOctileEntre(inicio_, Coordenadas(indice)) + km_, minimo};
+}
+
+/**
+ * @brief Recalcula rhs de una casilla y la mete o saca de la cola según sea consistente
+ * @param indice Casilla (fila * columnas + columna)
+ */
+void DStarLite::ActualizarVertice(size_t indice) {
+  ++nodos_tocados_;
+  if (indice != Indice(meta_)) {
+    const auto [fila, columna] = Coordenadas(indice);
+    double mejor = kInfinito;
+    for (const auto& vecino : laberinto_->GetVecinosCasilla(fila, columna)) {
+      mejor = std::min(mejor, vecino.coste + g_[vecino.indice]);
+    }
+    rhs_[indice] = mejor;
+  }
+  if (g_[indice] != rhs_[indice]) {
+    Encolar(indice);
+  } else {
+    // Borrado perezoso: la entrada se descarta cuando llegue a la cima
+    en_cola_[indice] = false;
+  }
+}
+
+/**
+ * @brief Inserta una casilla en la cola o actualiza su clave
+ */
+void DStarLite::Encolar(size_t indice) {
+  if (!en_cola_[indice]) {
+    en_cola_[indice] = true;
+    ++nodos_generados_;
+  }
+  clave_en_cola_[indice] = CalcularClave(indice);
+  cola_.push({clave_en_cola_[indice], indice});
+}
+
+/**
+ * @brief Saca de la cima las entradas que ya no están en la cola o tienen una clave antigua
+ */
+void DStarLite::DescartarObsoletas() {
+  while (!cola_.empty()) {
+    const auto& [clave, indice] = cola_.top();
+    if (en_cola_[indice] && clave == clave_en_cola_[indice]) {
+      return;
+    }
+    cola_.pop();
+  }
+}
+
+/**
+ * @brief Llama a visitar con cada casilla desde la que se puede mover a la casilla dada
+ *
+ * Se puede entrar en una casilla transitable desde cualquier vecina salvo en
+ * diagonal con las dos esquinas bloqueadas; la casilla de origen no importa.
+ */
+template <typename Visitante>
+void DStarLite::RecorrerPredecesores(size_t indice, Visitante&& visitar) const {
+  const auto [fila, columna] = Coordenadas(indice);
+  if (!laberinto_->getCasilla(fila, columna).EsTransitable()) {
+    return;
+  }
+  const int filas = laberinto_->filas();
+  const int columnas = laberinto_->columnas();
+  for (int df = -1; df <= 1; ++df) {
+    for (int dc = -1; dc <= 1; ++dc) {
+      const int f = static_cast<int>(fila) + df;
+      const int c = static_cast<int>(columna) + dc;
+      if ((df == 0 && dc == 0) || f < 0 || f >= filas || c < 0 || c >= columnas) {
+        continue;
+      }
+      if (df != 0 && dc != 0 && !laberinto_->getCasilla(fila, c).EsTransitable() &&
+          !laberinto_->getCasilla(f, columna).EsTransitable()) {
+        continue;
+      }
+      visitar(static_cast<size_t>(f) * columnas_ + static_cast<size_t>(c));
+    }
+  }
+}
@@ -0,0 +1,94 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Definición de la clase DStarLite (replanificación incremental)
+  * @version 1.0
+  */
+
+#ifndef DSTAR_LITE_H
+#define DSTAR_LITE_H
+
+#include <vector>
+#include <utility>
+#include <queue>
+#include <functional>
+#include <limits>
+#include "laberinto.h"
+
+/**
+ * @class DStarLite
+ * @brief Planificador D* Lite sobre un Laberinto dinámico
+ *
+ * Busca hacia atrás desde la salida manteniendo para cada casilla g(s) y
+ * rhs(s) = min(c(s, s') + g(s')). Entre iteraciones se conservan ambos valores:
+ * cuando el agente avanza solo crece el modificador de claves km, y cuando el
+ * entorno cambia solo se recalcula rhs en las casillas cuyos movimientos
+ * dependen de las casillas cambiadas. CalcularCaminoMasCorto repara entonces
+ * únicamente la región afectada en lugar de repetir la búsqueda completa.
+ *
+ * Las claves son [min(g, rhs) + h(inicio, s) + km ; min(g, rhs)] con la
+ * heurística octile (5/7), consistente con los costes de movimiento.
+ *
+ * Contadores de cada llamada a CalcularCaminoMasCorto (ver ReiniciarContadores):
+ * - Generados: casillas que entran en la cola de prioridad
+ * - Inspeccionados: casillas extraídas y expandidas
+ * - Tocados: casillas cuyo rhs se recalcula
+ */
+class DStarLite {
+ public:
+  DStarLite() = default;
+  explicit DStarLite(const Laberinto& laberinto) : laberinto_{&laberinto} {}
+  DStarLite(const DStarLite&) = delete;
+  DStarLite& operator=(const DStarLite&) = delete;
+  // Metodos de utilidad
+  void Inicializar(const std::pair<size_t, size_t>& inicio, const std::pair<size_t, size_t>& meta);
+  void MoverInicio(const std::pair<size_t, size_t>&);
+  void NotificarCambios(const std::vector<CambioCasilla>&);
+  bool CalcularCaminoMasCorto();
+  std::vector<std::pair<size_t, size_t>> ExtraerCamino() const;
+  void ReiniciarContadores() noexcept { nodos_generados_ = nodos_inspeccionados_ = nodos_tocados_ = 0; }
+  // Google style getters
+  double coste_inicio() const { return g_[Indice(inicio_)]; }
+  size_t nodos_generados() const noexcept { return nodos_generados_; }
+  size_t nodos_inspeccionados() const noexcept { return nodos_inspeccionados_; }
+  size_t nodos_tocados() const noexcept { return nodos_tocados_; }
+
+ private:
+  using Clave = std::pair<double, double>;
+  using EntradaCola = std::pair<Clave, size_t>;
+  static constexpr double kInfinito = std::numeric_limits<double>::infinity();
+  const Laberinto* laberinto_{};
+  size_t columnas_{};
+  std::pair<size_t, size_t> inicio_{};
+  std::pair<size_t, size_t> meta_{};
+  double km_{};
+  std::vector<double> g_{};
+  std::vector<double> rhs_{};
+  // Cola con borrado perezoso: una entrada es válida si la casilla sigue en la
+  // cola y su clave coincide con clave_en_cola_
+  std::priority_queue<EntradaCola, std::vector<EntradaCola>, std::greater<EntradaCola>> cola_{};
+  std::vector<Clave> clave_en_cola_{};
+  std::vector<bool> en_cola_{};
+  size_t nodos_generados_{};
+  size_t nodos_inspeccionados_{};
+  size_t nodos_tocados_{};
+
+  // Metodos auxiliares
+  size_t Indice(const std::pair<size_t, size_t>& pos) const noexcept { return pos.first * columnas_ + pos.second; }
+  std::pair<size_t, size_t> Coordenadas(size_t indice) const noexcept { return {indice / columnas_, indice % columnas_}; }
+  Clave CalcularClave(size_t indice) const;
+  void ActualizarVertice(size_t indice);
+  void Encolar(size_t indice);
+  void DescartarObsoletas();
+  template <typename Visitante>
+  void RecorrerPredecesores(size_t indice, Visitante&& visitar) const;
+};
+
+#endif
@@ -0,0 +1,49 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date Oct 16 2025
+  * @brief Declaracion de la clase FicheroMapeado (fichero de solo lectura en memoria con mmap)
+  * @version 1.0
+  */
+
+#ifndef FICHERO_MAPEADO_H
+#define FICHERO_MAPEADO_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * Clase FicheroMapeado
+ *       Proyecta un fichero completo en memoria (mmap) y lo libera al
+ *       destruirse. Evita copiar el fichero a un buffer propio.
+ *
+ *       Con copia_privada = true la proyección admite escritura con
+ *       copy-on-write: los cambios solo afectan a este proceso y nunca
+ *       llegan al fichero.
+ */
+class FicheroMapeado {
+ public:
+  explicit FicheroMapeado(const std::string& nombre, bool copia_privada = false);
+  ~FicheroMapeado();
+  FicheroMapeado(const FicheroMapeado&) = delete;
+  FicheroMapeado& operator=(const FicheroMapeado&) = delete;
+  // Google Style getters
+  const char* data() const noexcept { return datos_; }
+  char* data_escribible() noexcept { return copia_privada_ ? datos_ : nullptr; }
+  size_t size() const noexcept { return tamano_; }
+  const char* begin() const noexcept { return datos_; }
+  const char* end() const noexcept { return datos_ + tamano_; }
+
+ private:
+  char* datos_{nullptr};
+  size_t tamano_{};
+  bool copia_privada_{false};
+};
+
+#endif
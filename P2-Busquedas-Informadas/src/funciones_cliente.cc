@@ -16,6 +16,12 @@
 #include <iostream>
 #include <fstream> // Fichero de cabezera para trabajar con ficheros
 #include <string> // std::string
+#include <stdexcept>
+#include <optional>
+#include <cstdint>
+#include <limits>
+#include <iomanip> // std::setw
+#include <sstream>
 
 /**
  * @brief Comprueba los datos introducidos por parametros sean los esperados.
@@ -69,6 +75,38 @@ void Usage(void) {
   std::cout << "  input.txt    (obligatorio) Fichero de entrada con la definición del laberinto inicial." << std::endl;
   std::cout << "  output.txt   (opcional)    Nombre del fichero donde guardar la salida generada." << std::endl;
   std::cout << std::endl;
+  std::cout << "Modo conversión: ./BusquedasInformadas --convertir input.txt laberinto.bin" << std::endl;
+  std::cout << "  Guarda el laberinto en una instantánea binaria que se carga sin parsear (mmap)." << std::endl;
+  std::cout << "  El fichero .bin puede usarse después como input en lugar del de texto." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Opciones:" << std::endl;
+  std::cout << "  --traza=NIVEL  Traza de las búsquedas por std::cerr (por defecto 'vecino'):" << std::endl;
+  std::cout << "                 ninguno   sin traza, solo los resultados" << std::endl;
+  std::cout << "                 resumen   nodo inicial, camino encontrado e inicio/fin del modo dinámico" << std::endl;
+  std::cout << "                 iteracion además, cada nodo expandido y cada iteración dinámica" << std::endl;
+  std::cout << "                 vecino    además, cada vecino añadido o mejorado en A" << std::endl;
+  std::cout << "  --heuristica=NOMBRE Heurística de las opciones 2 y 3 del menú (por defecto 'manhattan'):" << std::endl;
+  for (const auto& entrada : HeuristicasRegistradas()) {
+    std::cout << "                 " << std::left << std::setw(10) << entrada.clave 
+              << entrada.descripcion << std::endl;
+  }
+  std::cout << "  --semilla=N    Semilla del dinamismo; la misma semilla repite la secuencia de laberintos" << std::endl;
+  std::cout << "                 (por defecto una aleatoria, que se muestra en las búsquedas dinámicas)." << std::endl;
+  std::cout << "  --pin=P        Probabilidad de que una casilla libre pase a obstáculo (por defecto 0.5)." << std::endl;
+  std::cout << "  --pout=P       Probabilidad de que un obstáculo pase a casilla libre (por defecto 0.5)." << std::endl;
+  std::cout << "  --max-bloqueo=R Fracción máxima de casillas bloqueadas (por defecto 0.25)." << std::endl;
+  std::cout << "  --replanificar=MODO Cuándo repite A* (o JPS+) la búsqueda dinámica (por defecto 'siempre'):" << std::endl;
+  std::cout << "                 siempre   tras cada paso del agente" << std::endl;
+  std::cout << "                 bloqueo   solo si el camino restante queda bloqueado" << std::endl;
+  std::cout << "  --umbral-mejora=R Con 'bloqueo', replanifica también si una casilla liberada puede" << std::endl;
+  std::cout << "                 abaratar el camino restante más de la fracción R (implica 'bloqueo')." << std::endl;
+  std::cout << "  --epsilon=E    Peso de la heurística en las opciones de A* (por defecto 1). Con E > 1" << std::endl;
+  std::cout << "                 expande menos nodos y el coste es como mucho E veces el óptimo." << std::endl;
+  std::cout << "  --epsilon-inicial=E ARA*: peso de la primera solución (por defecto 3)." << std::endl;
+  std::cout << "  --paso-epsilon=D ARA*: cuánto baja el peso en cada mejora (por defecto 0.5)." << std::endl;
+  std::cout << "  --presupuesto-ms=T ARA*: tiempo para mejorar la solución (por defecto 100 ms);" << std::endl;
+  std::cout << "                 la primera solución se devuelve siempre." << std::endl;
+  std::cout << std::endl;
   std::cout << "Notas:" << std::endl;
   std::cout << "  - Si no se especifica 'output.txt', la salida se mostrará por un nombre definido ya." << std::endl;
   std::cout << "  - Use -h o --help para ver esta ayuda." << std::endl;
@@ -76,9 +114,297 @@ void Usage(void) {
   std::cout << "Ejemplos:" << std::endl;
   std::cout << "  ./BusquedasInformadas test/M_1.txt" << std::endl;
   std::cout << "  ./BusquedasNoInformadas test/M_1.txt resultados.txt" << std::endl;
+  std::cout << "  ./BusquedasInformadas test/M_1.txt resultados.txt --traza=ninguno" << std::endl;
+  std::cout << "  ./BusquedasInformadas test/M_1.txt resultados.txt --semilla=42 --pin=0.1 --pout=0.1" << std::endl;
+  std::cout << "  ./BusquedasInformadas test/M_1.txt resultados.txt --heuristica=chebyshev" << std::endl;
+  std::cout << "  ./BusquedasInformadas test/M_1.txt resultados.txt --replanificar=bloqueo --umbral-mejora=0.1" << std::endl;
+  std::cout << "  ./BusquedasInformadas test/M_1.txt resultados.txt --epsilon=1.5" << std::endl;
+  std::cout << "  ./BusquedasInformadas test/M_1.txt resultados.txt --epsilon-inicial=2.5 --presupuesto-ms=20" << std::endl;
+  std::cout << "  ./BusquedasInformadas --convertir test/M_1.txt test/M_1.bin" << std::endl;
   std::cout << std::endl;
 }
 
+/**
+ * @brief Retira el parámetro i de argv desplazando los siguientes
+ * 
+ * @param argc Numero de parametros (se decrementa)
+ * @param argv Array de parametros (se compacta)
+ * @param i Posición del parámetro a retirar
+ */
+static void RetirarParametro(int& argc, char** argv, int i) {
+  for (int j = i; j < argc - 1; ++j) {
+    argv[j] = argv[j + 1];
+  }
+  argv[--argc] = nullptr;
+}
+
+/**
+ * @brief Busca la opción --traza=NIVEL entre los parámetros y la retira de argv
+ * 
+ * @param argc Numero de parametros (se decrementa si se encuentra la opción)
+ * @param argv Array de parametros (se compacta si se encuentra la opción)
+ * @param nivel Nivel de traza leído (no se modifica si no aparece la opción)
+ * @return false si el nivel indicado no es válido
+ */
+bool ExtraerNivelTraza(int& argc, char** argv, NivelTraza& nivel) {
+  const std::string prefijo{"--traza="};
+  for (int i = 1; i < argc; ++i) {
+    const std::string parametro{argv[i]};
+    if (parametro.rfind(prefijo, 0) != 0) continue;
+    const std::string valor = parametro.substr(prefijo.size());
+    if (valor == "ninguno") {
+      nivel = NivelTraza::kNinguno;
+    } else if (valor == "resumen") {
+      nivel = NivelTraza::kResumen;
+    } else if (valor == "iteracion") {
+      nivel = NivelTraza::kIteracion;
+    } else if (valor == "vecino") {
+      nivel = NivelTraza::kVecino;
+    } else {
+      std::cerr << "Nivel de traza no válido: '" << valor 
+                << "' (use ninguno, resumen, iteracion o vecino)" << std::endl;
+      return false;
+    }
+    RetirarParametro(argc, argv, i);
+    --i;
+  }
+  return true;
+}
+
+/**
+ * @brief Busca la opción --heuristica=NOMBRE entre los parámetros y la retira de argv
+ * 
+ * @param argc Numero de parametros (se decrementa si se encuentra la opción)
+ * @param argv Array de parametros (se compacta si se encuentra la opción)
+ * @param heuristica Heurística leída (no se modifica si no aparece la opción)
+ * @return false si la heurística indicada no está registrada
+ */
+bool ExtraerHeuristica(int& argc, char** argv, TipoHeuristica& heuristica) {
+  const std::string prefijo{"--heuristica="};
+  for (int i = 1; i < argc; ++i) {
+    const std::string parametro{argv[i]};
+    if (parametro.rfind(prefijo, 0) != 0) continue;
+    const std::string valor = parametro.substr(prefijo.size());
+    const std::optional<TipoHeuristica> tipo = BuscarHeuristica(valor);
+    if (!tipo) {
+      std::cerr << "Heurística no válida: '" << valor << "' (use";
+      for (const auto& entrada : HeuristicasRegistradas()) {
+        std::cerr << " " << entrada.clave;
+      }
+      std::cerr << ")" << std::endl;
+      return false;
+    }
+    heuristica = *tipo;
+    RetirarParametro(argc, argv, i);
+    --i;
+  }
+  return true;
+}
+
+/**
+ * @brief Busca las opciones del dinamismo entre los parámetros y las retira de argv
+ * 
+ * Opciones reconocidas: --semilla=N, --pin=P, --pout=P y --max-bloqueo=R.
+ * 
+ * @param argc Numero de parametros (se decrementa por cada opción encontrada)
+ * @param argv Array de parametros (se compacta por cada opción encontrada)
+ * @param semilla Semilla leída (no se modifica si no aparece --semilla)
+ * @param parametros Probabilidades y límite leídos (los que no aparecen no se modifican)
+ * @return false si algún valor no es un número válido
+ */
+bool ExtraerOpcionesDinamismo(int& argc, char** argv, std::optional<uint32_t>& semilla,
+                              ParametrosDinamismo& parametros) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string parametro{argv[i]};
+    const size_t igual = parametro.find('=');
+    if (parametro.rfind("--", 0) != 0 || igual == std::string::npos) continue;
+    const std::string nombre = parametro.substr(0, igual);
+    const std::string valor = parametro.substr(igual + 1);
+    double* destino = nullptr;
+    if (nombre == "--pin") {
+      destino = &parametros.pin;
+    } else if (nombre == "--pout") {
+      destino = &parametros.pout;
+    } else if (nombre == "--max-bloqueo") {
+      destino = &parametros.max_ratio;
+    } else if (nombre != "--semilla") {
+      continue;
+    }
+    try {
+      size_t leidos = 0;
+      if (destino != nullptr) {
+        *destino = std::stod(valor, &leidos);
+      } else {
+        // stoul acepta negativos (los convierte en módulo 2^64) y valores mayores que 32 bits
+        const unsigned long leida = std::stoul(valor, &leidos);
+        if (valor.find('-') != std::string::npos || leida > std::numeric_limits<uint32_t>::max()) {
+          throw std::out_of_range(valor);
+        }
+        semilla = static_cast<uint32_t>(leida);
+      }
+      if (leidos != valor.size()) {
+        throw std::invalid_argument(valor);
+      }
+    } catch (const std::exception&) {
+      std::cerr << "Valor no válido para " << nombre << ": '" << valor << "'" << std::endl;
+      return false;
+    }
+    RetirarParametro(argc, argv, i);
+    --i;
+  }
+  return true;
+}
+
+/**
+ * @brief Busca las opciones de replanificación entre los parámetros y las retira de argv
+ * 
+ * Opciones reconocidas: --replanificar=siempre|bloqueo y --umbral-mejora=R
+ * (esta última implica --replanificar=bloqueo).
+ * 
+ * @param argc Numero de parametros (se decrementa por cada opción encontrada)
+ * @param argv Array de parametros (se compacta por cada opción encontrada)
+ * @param politica Política leída (los campos que no aparecen no se modifican)
+ * @return false si algún valor no es válido
+ */
+bool ExtraerPoliticaReplanificacion(int& argc, char** argv, PoliticaReplanificacion& politica) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string parametro{argv[i]};
+    const size_t igual = parametro.find('=');
+    if (parametro.rfind("--", 0) != 0 || igual == std::string::npos) continue;
+    const std::string nombre = parametro.substr(0, igual);
+    const std::string valor = parametro.substr(igual + 1);
+    if (nombre == "--replanificar") {
+      if (valor == "siempre") {
+        politica.solo_si_bloqueado = false;
+      } else if (valor == "bloqueo") {
+        politica.solo_si_bloqueado = true;
+      } else {
+        std::cerr << "Valor no válido para --replanificar: '" << valor 
+                  << "' (use siempre o bloqueo)" << std::endl;
+        return false;
+      }
+    } else if (nombre == "--umbral-mejora") {
+      try {
+        size_t leidos = 0;
+        politica.umbral_mejora = std::stod(valor, &leidos);
+        if (leidos != valor.size()) {
+          throw std::invalid_argument(valor);
+        }
+      } catch (const std::exception&) {
+        std::cerr << "Valor no válido para --umbral-mejora: '" << valor << "'" << std::endl;
+        return false;
+      }
+      politica.solo_si_bloqueado = true;
+    } else {
+      continue;
+    }
+    RetirarParametro(argc, argv, i);
+    --i;
+  }
+  return true;
+}
+
+/**
+ * @brief Busca las opciones de A* ponderado y de ARA* entre los parámetros y las retira de argv
+ * 
+ * Opciones reconocidas: --epsilon=E, --epsilon-inicial=E, --paso-epsilon=D y --presupuesto-ms=T.
+ * 
+ * @param argc Numero de parametros (se decrementa por cada opción encontrada)
+ * @param argv Array de parametros (se compacta por cada opción encontrada)
+ * @param epsilon Peso de la heurística en A* (no se modifica si no aparece --epsilon)
+ * @param parametros Parámetros de ARA* leídos (los que no aparecen no se modifican)
+ * @return false si algún valor no es un número válido
+ */
+bool ExtraerOpcionesPonderacion(int& argc, char** argv, double& epsilon, ParametrosARA& parametros) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string parametro{argv[i]};
+    const size_t igual = parametro.find('=');
+    if (parametro.rfind("--", 0) != 0 || igual == std::string::npos) continue;
+    const std::string nombre = parametro.substr(0, igual);
+    const std::string valor = parametro.substr(igual + 1);
+    double* destino = nullptr;
+    if (nombre == "--epsilon") {
+      destino = &epsilon;
+    } else if (nombre == "--epsilon-inicial") {
+      destino = &parametros.epsilon_inicial;
+    } else if (nombre == "--paso-epsilon") {
+      destino = &parametros.paso_epsilon;
+    } else if (nombre == "--presupuesto-ms") {
+      destino = &parametros.presupuesto_ms;
+    } else {
+      continue;
+    }
+    try {
+      size_t leidos = 0;
+      *destino = std::stod(valor, &leidos);
+      if (leidos != valor.size()) {
+        throw std::invalid_argument(valor);
+      }
+    } catch (const std::exception&) {
+      std::cerr << "Valor no válido para " << nombre << ": '" << valor << "'" << std::endl;
+      return false;
+    }
+    RetirarParametro(argc, argv, i);
+    --i;
+  }
+  return true;
+}
+
+/**
+ * @brief Convierte un laberinto (texto o binario) en una instantánea binaria
+ * 
+ * @param entrada Fichero del laberinto a cargar
+ * @param salida Fichero binario a generar
+ * @return int Código de salida del programa (0 si todo fue bien)
+ */
+int ConvertirAInstantanea(const std::string& entrada, const std::string& salida) {
+  try {
+    Laberinto laberinto{entrada};
+    laberinto.GuardarInstantanea(salida);
+    std::cout << "Laberinto " << laberinto.filas() << "x" << laberinto.columnas() 
+              << " guardado como instantánea binaria en: " << salida << "\n";
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Nombre de la heurística en los reportes, indicando el peso si es A* ponderado
+ */
+static std::string NombrePonderado(const std::string& nombre, double epsilon) {
+  if (epsilon == 1.0) {
+    return nombre;
+  }
+  std::ostringstream os;
+  os << nombre << " ponderada (epsilon = " << epsilon << ")";
+  return os.str();
+}
+
+/**
+ * @brief Cota de subóptimo con dos decimales
+ */
+static std::string FormatearCota(double cota) {
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(2) << cota;
+  return os.str();
+}
+
+/**
+ * @brief Tabla con las soluciones sucesivas de ARA*
+ */
+static void ImprimirSolucionesARA(const std::vector<SolucionARA>& soluciones, std::ostream& os) {
+  os << "Soluciones de ARA* (coste <= cota x óptimo):\n";
+  os << "| Epsilon | Cota | Coste | Nodos Insp | Tiempo (ms) |\n";
+  os << "|---------|------|-------|------------|-------------|\n";
+  for (const SolucionARA& solucion : soluciones) {
+    os << "| " << solucion.epsilon << " | " << FormatearCota(solucion.cota) << " | " << solucion.coste
+       << " | " << solucion.nodos_inspeccionados << " | " << solucion.tiempo_ms << " |\n";
+  }
+  os << "\n";
+}
+
 /**
  * @brief Menu de opciones para realizar busquedas sobre un laberinto
  * 
@@ -97,7 +423,12 @@ void Menu(Laberinto& laberinto, BusquedaInformada& A, const std::string& output_
     std::cout << "5. Dinamizar laberinto\n";
     std::cout << "6. A* (Entorno Estático) OCTILE\n";
     std::cout << "7. A* (Entorno Dinámico) OCTILE\n";
-    std::cout << "8. Salir\n";
+    std::cout << "8. D* Lite (Entorno Dinámico) OCTILE\n";
+    std::cout << "9. JPS (Entorno Estático) OCTILE\n";
+    std::cout << "10. JPS+ (Entorno Dinámico) OCTILE\n";
+    std::cout << "11. ARA* (Entorno Estático) OCTILE\n";
+    std::cout << "12. ARA* (Entorno Dinámico) OCTILE\n";
+    std::cout << "13. Salir\n";
     std::cout << "Seleccione una opción: ";
     std::cin >> opcion;
     switch (opcion) {
@@ -120,13 +451,14 @@ void Menu(Laberinto& laberinto, BusquedaInformada& A, const std::string& output_
       case 2: 
         // A* Estático
         std::cout << "\n=== BÚSQUEDA A* ESTÁTICA ===\n";
-        if (A.BusquedaAStar(laberinto.coordenadas_start())) {
+        if (A.BusquedaAStar(laberinto.coordenadas_start(), A.heuristica())) {
+          const std::string nombre_heuristica = NombrePonderado(std::string{NombreHeuristica(A.heuristica())}, A.epsilon());
           if (!output_file.empty()) {
             std::ofstream out(output_file);
-            A.GenerarReporteCompleto(output_file, "Manhattan", out);
+            A.GenerarReporteCompleto(output_file, nombre_heuristica, out);
             std::cout << "Resultados en: " << output_file << "\n";
           } else {
-            A.GenerarReporteCompleto(output_file, "Manhattan", std::cout);
+            A.GenerarReporteCompleto(output_file, nombre_heuristica, std::cout);
           }
         } else {
           std::cout << "No se encontró camino.\n";
@@ -136,8 +468,13 @@ void Menu(Laberinto& laberinto, BusquedaInformada& A, const std::string& output_
       case 3: 
         // A* Dinámico
         std::cout << "\n=== BÚSQUEDA A* DINÁMICA ===\n";
-        if (A.BusquedaAStarDinamica(output_file)) {
+        std::cout << "Semilla del dinamismo: " << laberinto.semilla() << "\n";
+        if (A.BusquedaAStarDinamica(output_file, A.heuristica())) {
           std::cout << "Resultados en: " << output_file << "\n";
+          if (A.politica_replanificacion().solo_si_bloqueado) {
+            std::cout << "Replanificaciones evitadas: " << A.replanificaciones_evitadas() 
+                      << " de " << A.replanificaciones() + A.replanificaciones_evitadas() << "\n";
+          }
         } else {
           std::cout << "No se pudo completar la búsqueda dinámica.\n";
         }
@@ -161,10 +498,10 @@ void Menu(Laberinto& laberinto, BusquedaInformada& A, const std::string& output_
         if (A.BusquedaAStarH2(laberinto.coordenadas_start())) {
           if (!output_file.empty()) {
             std::ofstream out(output_file);
-            A.GenerarReporteCompleto(output_file, "Manhattan", out);
+            A.GenerarReporteCompleto(output_file, NombrePonderado("Octile", A.epsilon()), out);
             std::cout << "Resultados en: " << output_file << "\n";
           } else {
-            A.GenerarReporteCompleto(output_file, "Manhattan", std::cout);
+            A.GenerarReporteCompleto(output_file, NombrePonderado("Octile", A.epsilon()), std::cout);
           }
         } else {
           std::cout << "No se encontró camino.\n";
@@ -174,20 +511,100 @@ void Menu(Laberinto& laberinto, BusquedaInformada& A, const std::string& output_
       case 7: 
         // A* Dinámico
         std::cout << "\n=== BÚSQUEDA A* DINÁMICA ===\n";
+        std::cout << "Semilla del dinamismo: " << laberinto.semilla() << "\n";
         if (A.BusquedaAStarDinamicaH2(output_file)) {
           std::cout << "Resultados en: " << output_file << "\n";
+          if (A.politica_replanificacion().solo_si_bloqueado) {
+            std::cout << "Replanificaciones evitadas: " << A.replanificaciones_evitadas() 
+                      << " de " << A.replanificaciones() + A.replanificaciones_evitadas() << "\n";
+          }
         } else {
           std::cout << "No se pudo completar la búsqueda dinámica.\n";
         }
         break;
       
       case 8:
-        std::cout << "\nSaliendo del programa...\n";
+        // D* Lite Dinámico (replanificación incremental)
+        std::cout << "\n=== BÚSQUEDA D* LITE DINÁMICA ===\n";
+        std::cout << "Semilla del dinamismo: " << laberinto.semilla() << "\n";
+        if (A.BusquedaDStarLiteDinamica(output_file)) {
+          std::cout << "Resultados en: " << output_file << "\n";
+        } else {
+          std::cout << "No se pudo completar la búsqueda dinámica.\n";
+        }
+        break;
+
+      case 9:
+        // Jump Point Search Estático
+        std::cout << "\n=== BÚSQUEDA JPS ESTÁTICA ===\n";
+        if (A.BusquedaJPS(laberinto.coordenadas_start(), ModoJPS::kJPS)) {
+          if (!output_file.empty()) {
+            std::ofstream out(output_file);
+            A.GenerarReporteCompleto(output_file, "Octile (JPS)", out);
+            std::cout << "Resultados en: " << output_file << "\n";
+          } else {
+            A.GenerarReporteCompleto(output_file, "Octile (JPS)", std::cout);
+          }
+        } else {
+          std::cout << "No se encontró camino.\n";
+        }
+        break;
+
+      case 10:
+        // JPS+ Dinámico (tabla de saltos actualizada con los cambios de cada paso)
+        std::cout << "\n=== BÚSQUEDA JPS+ DINÁMICA ===\n";
+        std::cout << "Semilla del dinamismo: " << laberinto.semilla() << "\n";
+        if (A.BusquedaJPSDinamica(output_file, ModoJPS::kJPSPlus)) {
+          std::cout << "Resultados en: " << output_file << "\n";
+          if (A.politica_replanificacion().solo_si_bloqueado) {
+            std::cout << "Replanificaciones evitadas: " << A.replanificaciones_evitadas() 
+                      << " de " << A.replanificaciones() + A.replanificaciones_evitadas() << "\n";
+          }
+        } else {
+          std::cout << "No se pudo completar la búsqueda dinámica.\n";
+        }
+        break;
+
+      case 11:
+        // ARA* Estático (anytime)
+        std::cout << "\n=== BÚSQUEDA ARA* ESTÁTICA ===\n";
+        if (A.BusquedaARAStar(laberinto.coordenadas_start())) {
+          ImprimirSolucionesARA(A.soluciones_ara(), std::cout);
+          const std::string nombre_heuristica = "Octile (ARA*, cota " + FormatearCota(A.soluciones_ara().back().cota) + ")";
+          if (!output_file.empty()) {
+            std::ofstream out(output_file);
+            A.GenerarReporteCompleto(output_file, nombre_heuristica, out);
+            ImprimirSolucionesARA(A.soluciones_ara(), out);
+            std::cout << "Resultados en: " << output_file << "\n";
+          } else {
+            A.GenerarReporteCompleto(output_file, nombre_heuristica, std::cout);
+          }
+        } else {
+          std::cout << "No se encontró camino.\n";
+        }
+        break;
+
+      case 12:
+        // ARA* Dinámico (presupuesto de tiempo en cada planificación)
+        std::cout << "\n=== BÚSQUEDA ARA* DINÁMICA ===\n";
+        std::cout << "Semilla del dinamismo: " << laberinto.semilla() << "\n";
+        if (A.BusquedaARAStarDinamica(output_file)) {
+          std::cout << "Resultados en: " << output_file << "\n";
+          if (!A.soluciones_ara().empty()) {
+            std::cout << "Cota de la última planificación: " << FormatearCota(A.soluciones_ara().back().cota) << "\n";
+          }
+        } else {
+          std::cout << "No se pudo completar la búsqueda dinámica.\n";
+        }
         break;
         
+      case 13:
+        std::cout << "\nSaliendo del programa...\n";
+        break;
+
       default:
         std::cout << "Opción inválida.\n";
         break;
     }
-  } while (opcion != 8);
+  } while (opcion != 13);
 }
\ No newline at end of file
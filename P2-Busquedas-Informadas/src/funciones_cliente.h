@@ -15,6 +15,8 @@
 #ifndef FUNCIONES_CLIENTE_H
 #define FUNCIONES_CLIENTE_H
 
+#include <optional>
+#include <cstdint>
 #include "laberinto.h"
 #include "busqueda_informada.h"
 
@@ -22,5 +24,11 @@ bool CheckCorrectsParameters(const int, char**);
 void PrintProgramPorpouse(void);
 void Usage(void);
 void Menu(Laberinto&, BusquedaInformada&, const std::string&);
+int ConvertirAInstantanea(const std::string&, const std::string&);
+bool ExtraerNivelTraza(int&, char**, NivelTraza&);
+bool ExtraerHeuristica(int&, char**, TipoHeuristica&);
+bool ExtraerOpcionesDinamismo(int&, char**, std::optional<uint32_t>&, ParametrosDinamismo&);
+bool ExtraerPoliticaReplanificacion(int&, char**, PoliticaReplanificacion&);
+bool ExtraerOpcionesPonderacion(int&, char**, double&, ParametrosARA&);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Registro de heurísticas disponibles por nombre
+  * @version 1.0
+  */
+
+#include "heuristicas.h"
+#include <array>
+
+// Para añadir una heurística: functor en heuristicas.h, valor en TipoHeuristica,
+// caso en ConHeuristica y una entrada aquí
+static constexpr std::array<EntradaHeuristica, 4> kHeuristicas{{
+    {"manhattan", "Manhattan", TipoHeuristica::kManhattan, "Manhattan ponderada (W = 3), admisible con costes 5/7"},
+    {"octile", "Octile", TipoHeuristica::kOctile, "coste exacto sin obstáculos con 8-conectividad"},
+    {"chebyshev", "Chebyshev", TipoHeuristica::kChebyshev, "5 x max(dfila, dcolumna), admisible"},
+    {"euclidea", "Euclidea", TipoHeuristica::kEuclidea, "distancia euclídea escalada, admisible"},
+}};
+
+/**
+ * @brief Todas las heurísticas registradas, en el orden en que se muestran en la ayuda
+ */
+std::span<const EntradaHeuristica> HeuristicasRegistradas() {
+  return kHeuristicas;
+}
+
+/**
+ * @brief Busca una heurística por su nombre en la línea de comandos
+ * @param clave Nombre de la heurística (manhattan, octile, chebyshev, euclidea)
+ * @return El tipo de la heurística, o std::nullopt si no está registrada
+ */
+std::optional<TipoHeuristica> BuscarHeuristica(std::string_view clave) {
+  for (const auto& entrada : kHeuristicas) {
+    if (entrada.clave == clave) {
+      return entrada.tipo;
+    }
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Nombre de la heurística para los reportes
+ */
+std::string_view NombreHeuristica(TipoHeuristica tipo) {
+  for (const auto& entrada : kHeuristicas) {
+    if (entrada.tipo == tipo) {
+      return entrada.nombre;
+    }
+  }
+  return "Desconocida";
+}
@@ -0,0 +1,193 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Heurísticas de A* como functores y registro para elegirlas por nombre
+  * @version 1.0
+  *
+  * Cada heurística es un functor pequeño que guarda la salida y estima el coste
+  * desde una casilla. BusquedaInformada::BusquedaAStarGenerica es una plantilla
+  * sobre el functor, así que la heurística se expande en línea en el bucle de A*
+  * sin llamadas virtuales. ConHeuristica traduce un TipoHeuristica elegido en
+  * tiempo de ejecución (por ejemplo desde la línea de comandos) al functor concreto.
+  */
+
+#ifndef HEURISTICAS_H
+#define HEURISTICAS_H
+
+#include <string_view>
+#include <optional>
+#include <span>
+#include <utility>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "laberinto.h"
+
+/**
+ * @brief Diferencia absoluta en filas y columnas entre una casilla de referencia y otra
+ */
+inline std::pair<double, double> DiferenciasAbsolutas(const std::pair<size_t, size_t>& referencia,
+                                                      size_t fila, size_t columna) noexcept {
+  return {std::abs(static_cast<double>(referencia.first) - static_cast<double>(fila)),
+          std::abs(static_cast<double>(referencia.second) - static_cast<double>(columna))};
+}
+
+/**
+ * @brief Distancia octile entre dos casillas cualesquiera (5 ortogonal, 7 diagonal)
+ */
+inline double DistanciaOctileEntre(const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b) noexcept {
+  constexpr double D{5.0};
+  constexpr double D2{7.0};
+  const auto [diff_fila, diff_col] = DiferenciasAbsolutas(a, b.first, b.second);
+  const double maximo = std::max(diff_fila, diff_col);
+  const double minimo = std::min(diff_fila, diff_col);
+  return D2 * minimo + D * (maximo - minimo);
+}
+
+/**
+ * @class DistanciaManhattan
+ * @brief h(n) = W × (|Δfila| + |Δcolumna|) con W = 3
+ */
+class DistanciaManhattan {
+ public:
+  explicit DistanciaManhattan(const Laberinto& laberinto) : salida_{laberinto.coordenadas_exit()} {}
+  double operator()(size_t fila, size_t columna) const noexcept {
+    constexpr double W{3.0};
+    const auto [diff_fila, diff_col] = DiferenciasAbsolutas(salida_, fila, columna);
+    return (diff_fila + diff_col) * W;
+  }
+
+ private:
+  std::pair<size_t, size_t> salida_{};
+};
+
+/**
+ * @class DistanciaOctile
+ * @brief h(n) = 7 × min(Δ) + 5 × (max(Δ) − min(Δ)), coste exacto sin obstáculos
+ */
+class DistanciaOctile {
+ public:
+  explicit DistanciaOctile(const Laberinto& laberinto) : salida_{laberinto.coordenadas_exit()} {}
+  double operator()(size_t fila, size_t columna) const noexcept {
+    return DistanciaOctileEntre(salida_, {fila, columna});
+  }
+
+ private:
+  std::pair<size_t, size_t> salida_{};
+};
+
+/**
+ * @class DistanciaChebyshev
+ * @brief h(n) = 5 × max(Δ): cada paso avanza como mucho una fila y una columna
+ */
+class DistanciaChebyshev {
+ public:
+  explicit DistanciaChebyshev(const Laberinto& laberinto) : salida_{laberinto.coordenadas_exit()} {}
+  double operator()(size_t fila, size_t columna) const noexcept {
+    constexpr double D{5.0};
+    const auto [diff_fila, diff_col] = DiferenciasAbsolutas(salida_, fila, columna);
+    return D * std::max(diff_fila, diff_col);
+  }
+
+ private:
+  std::pair<size_t, size_t> salida_{};
+};
+
+/**
+ * @class DistanciaEuclidea
+ * @brief h(n) = (7 / √2) × distancia euclídea
+ *
+ * El factor 7 / √2 ≈ 4.95 hace que un diagonal cueste exactamente 7 y uno
+ * ortogonal menos de 5, así que la heurística sigue siendo admisible.
+ */
+class DistanciaEuclidea {
+ public:
+  explicit DistanciaEuclidea(const Laberinto& laberinto) : salida_{laberinto.coordenadas_exit()} {}
+  double operator()(size_t fila, size_t columna) const noexcept {
+    const double factor = 7.0 / std::sqrt(2.0);
+    const auto [diff_fila, diff_col] = DiferenciasAbsolutas(salida_, fila, columna);
+    return factor * std::sqrt(diff_fila * diff_fila + diff_col * diff_col);
+  }
+
+ private:
+  std::pair<size_t, size_t> salida_{};
+};
+
+/**
+ * @class HeuristicaPonderada
+ * @brief h'(n) = ε × h(n) para A* ponderado
+ *
+ * Con ε > 1 A* expande menos nodos a cambio de caminos que, si h es admisible,
+ * cuestan como mucho ε veces el óptimo.
+ */
+template <typename Heuristica>
+class HeuristicaPonderada {
+ public:
+  HeuristicaPonderada(const Heuristica& heuristica, double epsilon) : heuristica_{heuristica}, epsilon_{epsilon} {}
+  double operator()(size_t fila, size_t columna) const noexcept { return epsilon_ * heuristica_(fila, columna); }
+
+ private:
+  Heuristica heuristica_;
+  double epsilon_{1.0};
+};
+
+/**
+ * @struct CosteVecino
+ * @brief Política de coste por defecto: el coste que trae el Vecindario (5 ortogonal, 7 diagonal)
+ */
+struct CosteVecino {
+  double operator()(const Vecino& vecino) const noexcept { return vecino.coste; }
+};
+
+/**
+ * @brief Heurísticas disponibles en tiempo de ejecución
+ */
+enum class TipoHeuristica { kManhattan, kOctile, kChebyshev, kEuclidea };
+
+/**
+ * @struct EntradaHeuristica
+ * @brief Entrada del registro: nombre en la línea de comandos, nombre en los reportes y tipo
+ */
+struct EntradaHeuristica {
+  std::string_view clave{};
+  std::string_view nombre{};
+  TipoHeuristica tipo{};
+  std::string_view descripcion{};
+};
+
+std::span<const EntradaHeuristica> HeuristicasRegistradas();
+std::optional<TipoHeuristica> BuscarHeuristica(std::string_view clave);
+std::string_view NombreHeuristica(TipoHeuristica);
+
+/**
+ * @brief Llama a visitar con el functor de la heurística indicada
+ * @param tipo Heurística elegida en tiempo de ejecución
+ * @param laberinto Laberinto del que se toma la salida
+ * @param visitar Callable genérico que recibe el functor (se instancia una vez por heurística)
+ * @return Lo que devuelva visitar
+ *
+ * El switch se ejecuta una vez por búsqueda, fuera del bucle de A*.
+ */
+template <typename Visitante>
+decltype(auto) ConHeuristica(TipoHeuristica tipo, const Laberinto& laberinto, Visitante&& visitar) {
+  switch (tipo) {
+    case TipoHeuristica::kOctile:
+      return visitar(DistanciaOctile{laberinto});
+    case TipoHeuristica::kChebyshev:
+      return visitar(DistanciaChebyshev{laberinto});
+    case TipoHeuristica::kEuclidea:
+      return visitar(DistanciaEuclidea{laberinto});
+    case TipoHeuristica::kManhattan:
+    default:
+      return visitar(DistanciaManhattan{laberinto});
+  }
+}
+
+#endif
@@ -18,9 +18,19 @@
 #include <fstream>
 #include <random>
 #include <algorithm>
+#include <span>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
 #include "casilla.h"
 #include "laberinto.h"
+#include "heuristicas.h"
 
+// Direcciones de la 8-vecindad en el orden en que se generan los vecinos
+static constexpr std::array<int, 8> kDireccionFila{-1, -1, -1, 0, 0, 1, 1, 1};
+static constexpr std::array<int, 8> kDireccionColumna{-1, 0, 1, -1, 1, -1, 0, 1};
+static constexpr std::array<double, 8> kCosteDireccion{7.0, 5.0, 7.0, 5.0, 5.0, 7.0, 5.0, 7.0};
 
 //============================================================================
 // MÉTODOS DE INICIALIZACIÓN Y CONFIGURACIÓN
@@ -33,30 +43,64 @@
  * 
  * Lee las dimensiones del laberinto y construye la matriz de casillas.
  * Identifica automáticamente las posiciones de entrada (3) y salida (4).
+ * 
+ * Si el fichero es una instantánea binaria (ver GuardarInstantanea) se usa
+ * directamente su proyección en memoria, sin parsear ni copiar.
+ *
+ * Si la carga falla el laberinto conserva el contenido anterior: las casillas
+ * se leen en variables locales y solo se sustituyen al terminar.
  */
 void Laberinto::ProcesarLaberinto(const std::string& inputfile) {
+  auto fichero = std::make_unique<FicheroMapeado>(inputfile, true);
+  if (EsInstantanea(*fichero)) {
+    CargarInstantanea(std::move(fichero));
+    return;
+  }
+  fichero.reset();
   std::ifstream fichero_laberinto{inputfile};
   std::string line{};
   getline(fichero_laberinto, line);
-  filas_ = std::stoul(line);
+  const size_t filas = std::stoul(line);
   getline(fichero_laberinto, line);
-  columnas_ = std::stoul(line);
-  matriz_casillas_.resize(filas_, std::vector<Casilla>(columnas_));
-  for (size_t i{0}; i < filas_; ++i) {
-    for (size_t j{0}; j < columnas_; ++j) {
+  const size_t columnas = std::stoul(line);
+  // El borde exterior de obstáculos evita comprobar límites al generar vecinos
+  std::vector<Casilla> casillas((filas + 2) * (columnas + 2), Casilla(Tipo_Casilla::Obstaculo));
+  std::pair<size_t, size_t> coordenadas_start{coordenadas_start_};
+  std::pair<size_t, size_t> coordenadas_exit{coordenadas_exit_};
+  for (size_t i{0}; i < filas; ++i) {
+    for (size_t j{0}; j < columnas; ++j) {
       size_t valor{};
       fichero_laberinto >> valor;
       if (valor == 3) {
-        coordenadas_start_ = {i, j};
+        coordenadas_start = {i, j};
       }
       if (valor == 4) {
-        coordenadas_exit_ = {i, j};
+        coordenadas_exit = {i, j};
       }
       Tipo_Casilla tipo = FromInt(valor);
-      matriz_casillas_[i][j] = Casilla(tipo);
+      casillas[(i + 1) * (columnas + 2) + j + 1] = Casilla(tipo);
     }
   }
   fichero_laberinto.close();
+  filas_ = filas;
+  columnas_ = columnas;
+  coordenadas_start_ = coordenadas_start;
+  coordenadas_exit_ = coordenadas_exit;
+  almacen_casillas_ = std::move(casillas);
+  matriz_casillas_ = almacen_casillas_;
+  instantanea_.reset();
+  InicializarDesplazamientos();
+  IndexarCasillasCargadas();
+}
+
+/**
+ * @brief Calcula el desplazamiento en la matriz con borde de cada dirección
+ */
+void Laberinto::InicializarDesplazamientos() {
+  const std::ptrdiff_t ancho = static_cast<std::ptrdiff_t>(columnas_ + 2);
+  for (size_t k{0}; k < desplazamientos_.size(); ++k) {
+    desplazamientos_[k] = kDireccionFila[k] * ancho + kDireccionColumna[k];
+  }
 }
 
 
@@ -83,17 +127,33 @@ void Laberinto::CambiarEntradaYSalida(const std::pair<size_t, size_t>& entrada,
     throw std::invalid_argument("Posición de salida no válida.");
   }
   
+  // Tipo anterior de las casillas afectadas, para dejar el cambio en cambios_dinamismo()
+  const std::array<std::pair<size_t, size_t>, 4> afectadas{coordenadas_start_, coordenadas_exit_, entrada, salida};
+  std::array<Tipo_Casilla, 4> anteriores{};
+  for (size_t i = 0; i < afectadas.size(); ++i) {
+    anteriores[i] = CasillaEn(afectadas[i].first, afectadas[i].second).tipo();
+  }
+
   // Restaurar las antiguas posiciones a casilla libre
-  matriz_casillas_[coordenadas_start_.first][coordenadas_start_.second].setTipoCasilla(Tipo_Casilla::Libre);
-  matriz_casillas_[coordenadas_exit_.first][coordenadas_exit_.second].setTipoCasilla(Tipo_Casilla::Libre);
+  FijarTipo(coordenadas_start_.first, coordenadas_start_.second, Tipo_Casilla::Libre);
+  FijarTipo(coordenadas_exit_.first, coordenadas_exit_.second, Tipo_Casilla::Libre);
   
   // Establecer nuevas entrada y salida
-  matriz_casillas_[entrada.first][entrada.second].setTipoCasilla(Tipo_Casilla::Start);
-  matriz_casillas_[salida.first][salida.second].setTipoCasilla(Tipo_Casilla::Exit);
+  FijarTipo(entrada.first, entrada.second, Tipo_Casilla::Start);
+  FijarTipo(salida.first, salida.second, Tipo_Casilla::Exit);
   
   // Actualizar coordenadas almacenadas
   coordenadas_start_ = entrada;
   coordenadas_exit_ = salida;
+
+  cambios_.clear();
+  for (size_t i = 0; i < afectadas.size(); ++i) {
+    const bool repetida = std::find(afectadas.begin(), afectadas.begin() + i, afectadas[i]) != afectadas.begin() + i;
+    if (!repetida && CasillaEn(afectadas[i].first, afectadas[i].second).tipo() != anteriores[i]) {
+      cambios_.push_back({afectadas[i], anteriores[i]});
+    }
+  }
+  ++version_;
 }
 
 //============================================================================
@@ -105,20 +165,43 @@ void Laberinto::CambiarEntradaYSalida(const std::pair<size_t, size_t>& entrada,
    * @brief Aplica transformaciones dinámicas al laberinto
    * 
    * Ejecuta dos operaciones:
-   * 1. Mutación probabilística de casillas (pin=0.5, pout=0.5)
-   * 2. Enforcement del límite del 25% de obstáculos
+   * 1. Mutación probabilística de casillas (pin y pout de parametros_dinamismo())
+   * 2. Enforcement del límite max_ratio de obstáculos
    * 
-   * Este método simula cambios en el entorno durante la navegación.
+   * Este método simula cambios en el entorno durante la navegación. Usa el
+   * generador del laberinto, así que con la misma semilla (set_semilla) la
+   * secuencia de laberintos se repite.
    * 
+   * @throws std::runtime_error Si el laberinto es demasiado grande para el índice de obstáculos
    * @note Las posiciones de entrada y salida nunca mutan
    * @see MutarCeldas, EnforceMaxBloqueo
    */
 void Laberinto::ActualizarDinamismo() {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  double pin{0.5}, pout{0.5};
-  MutarCeldas(pin, pout, gen);
-  EnforceMaxBloqueo(0.25, gen);
+  AsegurarIndiceObstaculos();
+  ++version_;
+  cambios_.clear();
+  std::vector<size_t> nuevos_obstaculos =
+      MutarCeldas(parametros_dinamismo_.pin, parametros_dinamismo_.pout, generador_);
+  EnforceMaxBloqueo(parametros_dinamismo_.max_ratio, generador_, nuevos_obstaculos);
+  for (const size_t indice : nuevos_obstaculos) {
+    const auto [fila, columna] = CoordenadasDeIndice(indice);
+    cambios_.push_back({{fila, columna}, Tipo_Casilla::Libre});
+    FijarTipo(fila, columna, Tipo_Casilla::Obstaculo);
+  }
+}
+
+/**
+ * @brief Cambia las probabilidades de mutación y el límite de obstáculos
+ * @param parametros Nuevos pin, pout y max_ratio
+ * @throws std::invalid_argument Si algún valor no está en [0, 1]
+ */
+void Laberinto::set_parametros_dinamismo(const ParametrosDinamismo& parametros) {
+  for (const double valor : {parametros.pin, parametros.pout, parametros.max_ratio}) {
+    if (!(valor >= 0.0 && valor <= 1.0)) {
+      throw std::invalid_argument("Los parámetros del dinamismo deben estar entre 0 y 1.");
+    }
+  }
+  parametros_dinamismo_ = parametros;
 }
 
 //============================================================================
@@ -129,28 +212,25 @@ void Laberinto::ActualizarDinamismo() {
  * @brief Obtiene las casillas vecinas transitables de una posición
  * @param fila Fila de la casilla origen
  * @param columna Columna de la casilla origen
- * @return Vector con las coordenadas de los vecinos válidos
+ * @return Vecindario con las coordenadas, índice y coste de cada vecino válido
+ * 
+ * Consulta la máscara de movimientos legales de la casilla, que ya tiene en
+ * cuenta límites, obstáculos y la regla de esquinas de EsMovimientoValido.
+ * No reserva memoria dinámica.
  */
-std::vector<std::pair<size_t, size_t>> Laberinto::GetVecinosCasilla(const size_t fila, const size_t columna) const {
-  std::vector<std::pair<size_t, size_t>> vecinos;
-  
-  // Definir todas las direcciones posibles (8-vecindad)
-  const std::vector<std::pair<int, int>> direcciones = {
-    {-1, -1}, {-1, 0}, {-1, 1},  // Superior izquierda, superior, superior derecha
-    {0, -1},           {0, 1},   // Izquierda, derecha
-    {1, -1},  {1, 0},  {1, 1}    // Inferior izquierda, inferior, inferior derecha
-  };
-  
-  for (const auto& dir : direcciones) {
-    size_t nueva_fila = fila + dir.first;
-    size_t nueva_columna = columna + dir.second;
-    
-    if (EsMovimientoValido(fila, columna, nueva_fila, nueva_columna)) {
-      vecinos.emplace_back(nueva_fila, nueva_columna);
-    }
+Vecindario Laberinto::GetVecinosCasilla(const size_t fila, const size_t columna) const {
+  Vecindario vecindario;
+  // Solo se recorren los bits a 1 de la máscara precalculada
+  for (uint8_t mascara = mascaras_movimiento_[IndiceConBorde(fila, columna)]; mascara != 0;
+       mascara &= static_cast<uint8_t>(mascara - 1)) {
+    const int k = std::countr_zero(mascara);
+    const size_t nueva_fila = fila + kDireccionFila[k];
+    const size_t nueva_columna = columna + kDireccionColumna[k];
+    vecindario.vecinos[vecindario.cantidad++] = {{nueva_fila, nueva_columna},
+                                                 nueva_fila * columnas_ + nueva_columna,
+                                                 kCosteDireccion[k]};
   }
-  
-  return vecinos;
+  return vecindario;
 }
 
 /**
@@ -188,26 +268,17 @@ double Laberinto::MoveCost(const size_t fila_actual, const size_t col_actual,
   * @note Esta heurística es admisible ya que W × Manhattan ≤ coste_real
   */
 double Laberinto::HeuristicaManhattan(const size_t fila_actual, const size_t col_actual) const {
-  constexpr double W = 3.0;
-  int diff_fila = std::abs(static_cast<int>(coordenadas_exit_.first) - static_cast<int>(fila_actual));
-  int diff_col = std::abs(static_cast<int>(coordenadas_exit_.second) - static_cast<int>(col_actual));
-  return (diff_fila + diff_col) * W;
+  return DistanciaManhattan{*this}(fila_actual, col_actual);
 }
 
 
 double Laberinto::HeuristicaOctile(const size_t fila_actual, const size_t col_actual) const {
-  int diff_fila = std::abs(static_cast<int>(coordenadas_exit_.first) - static_cast<int>(fila_actual));
-  int diff_col = std::abs(static_cast<int>(coordenadas_exit_.second) - static_cast<int>(col_actual));
-  int max_x = std::max(diff_col, diff_fila);
-  int min_y = std::min(diff_col, diff_fila);
-  constexpr double D{5.0};
-  constexpr double D2{7.0};
-  return D2 * static_cast<double>(min_y) + D * (static_cast<double>(max_x) - static_cast<double>(min_y));
+  return DistanciaOctile{*this}(fila_actual, col_actual);
 }
 
 /**
  * @brief Calcula el coste total de un camino dado
- * @param camino Vector con las coordenadas del camino (secuencia de posiciones)
+ * @param camino Coordenadas del camino (secuencia de posiciones)
  * @return Coste total del camino
  * 
  * Calcula la suma de los costes de movimiento entre cada par de posiciones
@@ -217,7 +288,7 @@ double Laberinto::HeuristicaOctile(const size_t fila_actual, const size_t col_ac
  * @note Útil para calcular el coste real de un camino ya recorrido,
  *       incluso si el entorno cambió después.
  */
-double Laberinto::CalcularCosteCamino(const std::vector<std::pair<size_t, size_t>>& camino) const {
+double Laberinto::CalcularCosteCamino(std::span<const std::pair<size_t, size_t>> camino) const {
    // Camino vacío o con solo una posición tiene coste 0
   if (camino.size() <= 1) {
     return 0.0;
@@ -280,7 +351,7 @@ bool Laberinto::EsCoordenadaValida(size_t fila, size_t columna) const noexcept {
 bool Laberinto::EsSalidaValida(size_t fila, size_t columna) const noexcept {
   if (!EsCoordenadaValida(fila, columna)) return false;
   if (!EsBorde(fila, columna)) return false;
-  // if (matriz_casillas_[fila][columna].tipo() == Tipo_Casilla::Obstaculo) return false;
+  // if (CasillaEn(fila, columna).tipo() == Tipo_Casilla::Obstaculo) return false;
   return true;
 }
 
@@ -293,7 +364,7 @@ bool Laberinto::EsSalidaValida(size_t fila, size_t columna) const noexcept {
 bool Laberinto::EsEntradaValida(size_t fila, size_t columna) const noexcept {
   if (!EsCoordenadaValida(fila, columna)) return false;
   if (!EsBorde(fila, columna)) return false;
-  // if (matriz_casillas_[fila][columna].tipo() == Tipo_Casilla::Obstaculo) return false;
+  // if (CasillaEn(fila, columna).tipo() == Tipo_Casilla::Obstaculo) return false;
   return true;
 }
 
@@ -367,7 +438,7 @@ bool Laberinto::EsMovimientoValido(size_t fila_actual, size_t col_actual,
   }
   
   // Verificar que la casilla vecina no es un obstáculo
-  if (matriz_casillas_[fila_vecina][col_vecina].tipo() == Tipo_Casilla::Obstaculo) {
+  if (CasillaEn(fila_vecina, col_vecina).tipo() == Tipo_Casilla::Obstaculo) {
     return false;
   }
   
@@ -382,8 +453,8 @@ bool Laberinto::EsMovimientoValido(size_t fila_actual, size_t col_actual,
   // Para movimientos diagonales, verificar que no hay obstáculos en las celdas adyacentes
   if (diff_fila == 1 && diff_col == 1) {
     // Verificar que ambas celdas adyacentes no son obstáculos
-    bool obstaculo_horizontal = matriz_casillas_[fila_actual][col_vecina].tipo() == Tipo_Casilla::Obstaculo;
-    bool obstaculo_vertical = matriz_casillas_[fila_vecina][col_actual].tipo() == Tipo_Casilla::Obstaculo;
+    bool obstaculo_horizontal = CasillaEn(fila_actual, col_vecina).tipo() == Tipo_Casilla::Obstaculo;
+    bool obstaculo_vertical = CasillaEn(fila_vecina, col_actual).tipo() == Tipo_Casilla::Obstaculo;
     
     if (obstaculo_horizontal && obstaculo_vertical) {
       return false; // No se puede mover en diagonal si ambas adyacentes son obstáculos
@@ -393,38 +464,148 @@ bool Laberinto::EsMovimientoValido(size_t fila_actual, size_t col_actual,
   return true;
 }
 
+//============================================================================
+// MÉTODOS PRIVADOS DE LA MÁSCARA DE MOVIMIENTOS
+//============================================================================
+
+/**
+ * @brief Calcula qué movimientos de la 8-vecindad son legales desde una casilla
+ * @param indice_con_borde Índice de la casilla en la matriz con borde
+ * @return Máscara con el bit k a 1 si la dirección k es legal
+ * @note Misma regla que EsMovimientoValido: el destino debe ser transitable y
+ *       una diagonal se prohíbe si las dos casillas ortogonales son obstáculos
+ */
+uint8_t Laberinto::CalcularMascara(size_t indice_con_borde) const noexcept {
+  const Casilla* origen = matriz_casillas_.data() + indice_con_borde;
+  uint8_t mascara{0};
+  for (size_t k{0}; k < desplazamientos_.size(); ++k) {
+    if (!origen[desplazamientos_[k]].EsTransitable()) {
+      continue;
+    }
+    if (kDireccionFila[k] != 0 && kDireccionColumna[k] != 0 &&
+        !origen[kDireccionColumna[k]].EsTransitable() &&
+        !origen[desplazamientos_[k] - kDireccionColumna[k]].EsTransitable()) {
+      continue;
+    }
+    mascara |= static_cast<uint8_t>(1u << k);
+  }
+  return mascara;
+}
+
+/**
+ * @brief Recalcula las máscaras afectadas por el cambio de una casilla
+ * @param fila Fila de la casilla modificada
+ * @param columna Columna de la casilla modificada
+ * @note Una casilla solo interviene en los movimientos de sus 8 vecinas
+ *       (como destino o como esquina de una diagonal)
+ */
+void Laberinto::RecalcularMascarasAlrededor(size_t fila, size_t columna) {
+  for (size_t k{0}; k < desplazamientos_.size(); ++k) {
+    const size_t vecina_fila = fila + kDireccionFila[k];
+    const size_t vecina_columna = columna + kDireccionColumna[k];
+    if (EsCoordenadaValida(vecina_fila, vecina_columna)) {
+      const size_t indice = IndiceConBorde(vecina_fila, vecina_columna);
+      mascaras_movimiento_[indice] = CalcularMascara(indice);
+    }
+  }
+}
+
+/**
+ * @brief Cambia el tipo de una casilla manteniendo al día las máscaras, el número de obstáculos
+ *        y, si ya está construido, el índice de obstáculos
+ * @param fila Fila de la casilla
+ * @param columna Columna de la casilla
+ * @param tipo Nuevo tipo de la casilla
+ */
+void Laberinto::FijarTipo(size_t fila, size_t columna, const Tipo_Casilla tipo) {
+  const size_t indice = IndiceConBorde(fila, columna);
+  Casilla& casilla = matriz_casillas_[indice];
+  const bool era_transitable = casilla.EsTransitable();
+  const bool era_obstaculo = casilla.tipo() == Tipo_Casilla::Obstaculo;
+  const bool es_obstaculo = tipo == Tipo_Casilla::Obstaculo;
+  const bool hay_indice = !posicion_obstaculo_.empty();
+  if (es_obstaculo && !era_obstaculo) {
+    ++numero_obstaculos_;
+    if (hay_indice) {
+      posicion_obstaculo_[indice] = static_cast<uint32_t>(obstaculos_.size());
+      obstaculos_.push_back(indice);
+    }
+  } else if (era_obstaculo && !es_obstaculo) {
+    --numero_obstaculos_;
+    if (hay_indice) {
+      // Borrado O(1): el último obstáculo del índice ocupa el hueco
+      const uint32_t hueco = posicion_obstaculo_[indice];
+      obstaculos_[hueco] = obstaculos_.back();
+      posicion_obstaculo_[obstaculos_[hueco]] = hueco;
+      obstaculos_.pop_back();
+      posicion_obstaculo_[indice] = kNoEsObstaculo;
+    }
+  }
+  casilla.setTipoCasilla(tipo);
+  if (casilla.EsTransitable() != era_transitable) {
+    RecalcularMascarasAlrededor(fila, columna);
+  }
+}
+
 //============================================================================
 // MÉTODOS PRIVADOS DE DINAMISMO
 //============================================================================
 
+/**
+ * @brief Recorre los éxitos de n ensayos de Bernoulli(p) saltando entre ellos
+ * @param n Número de ensayos (0 .. n - 1)
+ * @param p Probabilidad de éxito de cada ensayo
+ * @param rd Generador de números aleatorios
+ * @param visitar Función llamada con el número de cada ensayo con éxito, en orden creciente
+ * 
+ * El hueco hasta el siguiente éxito sigue una distribución geométrica, así que el
+ * coste es O(n * p) números aleatorios en lugar de uno por ensayo.
+ */
+template <typename Visitar>
+static void RecorrerExitosBernoulli(const size_t n, const double p, std::mt19937& rd, Visitar visitar) {
+  if (p <= 0.0) return;
+  if (p >= 1.0) {
+    for (size_t k{0}; k < n; ++k) visitar(k);
+    return;
+  }
+  std::geometric_distribution<size_t> hueco(p);
+  for (size_t k = hueco(rd); k < n; k += 1 + hueco(rd)) {
+    visitar(k);
+  }
+}
+
 /**
  * @brief Aplica mutaciones probabilísticas a las casillas
  * @param pin Probabilidad de que una casilla libre se convierta en obstáculo
  * @param pout Probabilidad de que un obstáculo se convierta en casilla libre
  * @param rd Generador de números aleatorios
- * @note Los valores típicos son pin=pout=0.5 para máxima aleatoriedad
+ * @return Índices con borde de las casillas libres que pasan a obstáculo (aún sin aplicar)
+ * 
+ * Cada casilla libre pasa a obstáculo con probabilidad pin y cada obstáculo pasa a
+ * libre con probabilidad pout, de forma independiente y según el estado anterior al
+ * paso. Los candidatos a obstáculo se muestrean sobre todas las casillas (descartando
+ * las que no están libres) y los candidatos a libre sobre el índice de obstáculos.
+ * Los obstáculos que se liberan se aplican aquí; los nuevos se devuelven para que
+ * EnforceMaxBloqueo pueda descartar algunos sin llegar a colocarlos.
  */
-void Laberinto::MutarCeldas(const double pin, const double pout, std::mt19937& rd) {
-  std::uniform_real_distribution<double> dist(0.0, 1.0);
-  for (size_t i{0}; i < filas_; ++i) {
-    for (size_t j{0}; j < columnas_; ++j) {
-      if (std::make_pair(i, j) == coordenadas_start_ || std::make_pair(i, j) == coordenadas_exit_) {
-        continue;
-      }
-      double U = dist(rd);
-      // std::cerr << U << std::endl; // DEBUG
-      auto& casilla = matriz_casillas_[i][j];
-      if (casilla.tipo() == Tipo_Casilla::Libre) {
-        if (U >= (1.0 - pin)) {
-          casilla.setTipoCasilla(Tipo_Casilla::Obstaculo);
-        }
-      } else if (casilla.tipo() == Tipo_Casilla::Obstaculo) {
-        if (U >= (1.0 - pout)) {
-          casilla.setTipoCasilla(Tipo_Casilla::Libre);
-        }
-      }
+std::vector<size_t> Laberinto::MutarCeldas(const double pin, const double pout, std::mt19937& rd) {
+  std::vector<size_t> a_obstaculo{};
+  RecorrerExitosBernoulli(filas_ * columnas_, pin, rd, [&](size_t k) {
+    const size_t indice = IndiceConBorde(k / columnas_, k % columnas_);
+    if (matriz_casillas_[indice].tipo() == Tipo_Casilla::Libre) {
+      a_obstaculo.push_back(indice);
     }
+  });
+  std::vector<size_t> a_libre{};
+  RecorrerExitosBernoulli(obstaculos_.size(), pout, rd, [&](size_t k) {
+    a_libre.push_back(obstaculos_[k]);
+  });
+  for (const size_t indice : a_libre) {
+    const auto [fila, columna] = CoordenadasDeIndice(indice);
+    cambios_.push_back({{fila, columna}, Tipo_Casilla::Obstaculo});
+    FijarTipo(fila, columna, Tipo_Casilla::Libre);
   }
+  return a_obstaculo;
 }
 
 
@@ -432,57 +613,81 @@ void Laberinto::MutarCeldas(const double pin, const double pout, std::mt19937& r
  * @brief Garantiza que no más del max_ratio de casillas sean obstáculos
  * @param max_ratio Ratio máximo permitido de obstáculos (0.0-1.0)
  * @param rd Generador de números aleatorios
- * @note El valor típico es max_ratio=0.25 (25% máximo de obstáculos)
+ * @param nuevos_obstaculos Obstáculos pendientes de colocar en este paso (se pueden descartar)
+ * 
+ * Elige el exceso al azar y sin repetición entre los obstáculos actuales y los
+ * pendientes, como un Fisher-Yates parcial sobre su concatenación, en O(exceso).
+ * Los obstáculos actuales elegidos se liberan y los pendientes elegidos se descartan,
+ * así que ninguna casilla cambia dos veces en el mismo paso.
  */
-void Laberinto::EnforceMaxBloqueo(const double max_ratio,std::mt19937& rd) {
-  const size_t porcentaje_bloqueadas = ContarPorcentajeBloqueadas();
-  if (porcentaje_bloqueadas < static_cast<size_t>(max_ratio * 100)) {
-    return;
-  }
-  std::vector<std::pair<size_t, size_t>> casillas_bloqueadas = ObtenerCasillasBloqueadas();
+void Laberinto::EnforceMaxBloqueo(const double max_ratio, std::mt19937& rd,
+                                  std::vector<size_t>& nuevos_obstaculos) {
   const size_t max_bloqueadas = static_cast<size_t>(max_ratio * filas_ * columnas_);
-  size_t exceso = casillas_bloqueadas.size() - max_bloqueadas;
-  std::shuffle(casillas_bloqueadas.begin(), casillas_bloqueadas.end(), rd);
-  for (size_t i{0}; i < exceso; ++i) {
-    auto [f, c] = casillas_bloqueadas[i];
-    // std::cerr << f << ", " << c << std::endl; // DEBUG
-    matriz_casillas_[f][c].setTipoCasilla(Tipo_Casilla::Libre);
+  while (obstaculos_.size() + nuevos_obstaculos.size() > max_bloqueadas) {
+    std::uniform_int_distribution<size_t> elegir(0, obstaculos_.size() + nuevos_obstaculos.size() - 1);
+    const size_t k = elegir(rd);
+    if (k >= obstaculos_.size()) {
+      nuevos_obstaculos[k - obstaculos_.size()] = nuevos_obstaculos.back();
+      nuevos_obstaculos.pop_back();
+      continue;
+    }
+    const auto [fila, columna] = CoordenadasDeIndice(obstaculos_[k]);
+    cambios_.push_back({{fila, columna}, Tipo_Casilla::Obstaculo});
+    FijarTipo(fila, columna, Tipo_Casilla::Libre);
   }
 }
 
 /**
- * @brief Obtiene una lista de todas las posiciones con obstáculos
- * @return Vector con las coordenadas de todas las casillas bloqueadas
- * @note No incluye entrada ni salida, solo obstáculos puros
+ * @brief Calcula las máscaras de las casillas recién cargadas y cuenta los obstáculos
+ * @note Solo se llama al cargar, con casillas ya validadas; después FijarTipo
+ *       mantiene máscaras y cuenta en O(1). Las máscaras no forman parte de
+ *       las instantáneas, siempre se derivan de las casillas. El índice de obstáculos se descarta y lo reconstruye AsegurarIndiceObstaculos
+ *       si se llega a usar el dinamismo.
  */
-std::vector<std::pair<size_t, size_t>> Laberinto::ObtenerCasillasBloqueadas() const {
-  std::vector<std::pair<size_t, size_t>> casillas_bloqueadas{};
+void Laberinto::IndexarCasillasCargadas() {
+  almacen_mascaras_.assign(matriz_casillas_.size(), 0);
+  mascaras_movimiento_ = almacen_mascaras_;
+  obstaculos_ = {};
+  posicion_obstaculo_ = {};
+  numero_obstaculos_ = 0;
   for (size_t i{0}; i < filas_; ++i) {
     for (size_t j{0}; j < columnas_; ++j) {
-      if (matriz_casillas_[i][j].tipo() == Tipo_Casilla::Obstaculo) {
-        casillas_bloqueadas.emplace_back(i, j);
+      const size_t indice = IndiceConBorde(i, j);
+      mascaras_movimiento_[indice] = CalcularMascara(indice);
+      if (matriz_casillas_[indice].tipo() == Tipo_Casilla::Obstaculo) {
+        ++numero_obstaculos_;
       }
     }
   }
-  return casillas_bloqueadas;
+  // Una carga avanza dos versiones: no es un paso descrito por cambios_dinamismo()
+  cambios_.clear();
+  version_ += 2;
 }
 
 /**
- * @brief Cuenta el número total de obstáculos en el laberinto
- * @return Cantidad de casillas de tipo Obstáculo
- * @note No cuenta entrada ni salida, solo obstáculos puros
+ * @brief Construye el índice de obstáculos si aún no existe
+ * @throws std::runtime_error Si el laberinto tiene más casillas de las que admite el índice
+ * @note Un recorrido completo la primera vez; después FijarTipo lo mantiene en O(1)
  */
-size_t Laberinto::ContarObstaculos() const noexcept {
-  size_t casillas_obstaculo{};
+void Laberinto::AsegurarIndiceObstaculos() {
+  if (!posicion_obstaculo_.empty()) {
+    return;
+  }
+  if (filas_ * columnas_ >= kNoEsObstaculo) {
+    throw std::runtime_error("Laberinto demasiado grande para el dinamismo");
+  }
+  obstaculos_.clear();
+  obstaculos_.reserve(numero_obstaculos_);
+  posicion_obstaculo_.assign(matriz_casillas_.size(), kNoEsObstaculo);
   for (size_t i{0}; i < filas_; ++i) {
     for (size_t j{0}; j < columnas_; ++j) {
-      const auto& casilla = matriz_casillas_[i][j];
-      if (casilla.tipo() == Tipo_Casilla::Obstaculo) {
-        ++casillas_obstaculo;
+      const size_t indice = IndiceConBorde(i, j);
+      if (matriz_casillas_[indice].tipo() == Tipo_Casilla::Obstaculo) {
+        posicion_obstaculo_[indice] = static_cast<uint32_t>(obstaculos_.size());
+        obstaculos_.push_back(indice);
       }
     }
   }
-  return casillas_obstaculo;
 }
 
   /**
@@ -496,6 +701,154 @@ size_t Laberinto::ContarPorcentajeBloqueadas() const noexcept {
   return static_cast<size_t>(porcentaje);
 }
 
+//============================================================================
+// INSTANTÁNEAS BINARIAS
+//============================================================================
+
+/**
+ * @brief Cabecera de una instantánea binaria de Laberinto (versión 1, little-endian)
+ * 
+ * Tras la cabecera van (filas + 2) x (columnas + 2) bytes con las casillas de
+ * la matriz con borde. Las máscaras de movimiento no se guardan: se calculan
+ * al cargar a partir de las casillas.
+ */
+struct CabeceraInstantaneaLaberinto {
+  char magia[8];
+  uint32_t version;
+  uint32_t orden_bytes;
+  uint64_t filas;
+  uint64_t columnas;
+  uint64_t start_fila;
+  uint64_t start_columna;
+  uint64_t exit_fila;
+  uint64_t exit_columna;
+};
+
+static constexpr char kMagiaLaberinto[8] = {'I', 'A', 'L', 'A', 'B', 'E', 'R', '\0'};
+static constexpr uint32_t kVersionInstantaneaLaberinto = 1;
+static constexpr uint32_t kOrdenBytes = 0x01020304;
+
+/**
+ * @brief Comprueba que una casilla del borde de una instantánea sea un obstáculo
+ * @throws std::runtime_error Si no lo es
+ */
+static void ComprobarBordeCargado(const Casilla& casilla) {
+  if (casilla.tipo() != Tipo_Casilla::Obstaculo) {
+    throw std::runtime_error("Instantánea de laberinto con un borde que no es obstáculo");
+  }
+}
+
+/**
+ * @brief Comprueba las casillas con borde de una instantánea antes de usarlas
+ * @param casillas Matriz con borde proyectada
+ * @param filas Número de filas sin el borde
+ * @param columnas Número de columnas sin el borde
+ * @throws std::runtime_error Si el borde no es de obstáculos o alguna casilla tiene un tipo desconocido
+ * @note El borde importa porque las máscaras y EsTransitable confían en él
+ */
+void Laberinto::ValidarCasillas(std::span<const Casilla> casillas, size_t filas, size_t columnas) {
+  const size_t ancho = columnas + 2;
+  for (size_t k{0}; k < ancho; ++k) {
+    ComprobarBordeCargado(casillas[k]);
+    ComprobarBordeCargado(casillas[(filas + 1) * ancho + k]);
+  }
+  for (size_t i{1}; i <= filas; ++i) {
+    ComprobarBordeCargado(casillas[i * ancho]);
+    ComprobarBordeCargado(casillas[i * ancho + ancho - 1]);
+    for (size_t j{1}; j <= columnas; ++j) {
+      FromInt(static_cast<int>(casillas[i * ancho + j].tipo()));
+    }
+  }
+}
+
+/**
+ * @brief Comprueba si un fichero empieza por la marca de instantánea de Laberinto
+ * @param fichero Fichero proyectado en memoria
+ * @return true si es una instantánea binaria, false si debe tratarse como texto
+ */
+bool Laberinto::EsInstantanea(const FicheroMapeado& fichero) {
+  return fichero.size() >= sizeof(kMagiaLaberinto) &&
+         std::memcmp(fichero.data(), kMagiaLaberinto, sizeof(kMagiaLaberinto)) == 0;
+}
+
+/**
+ * @brief Guarda el estado actual del laberinto en una instantánea binaria
+ * @param outputfile Ruta del fichero binario a crear
+ * @throws std::runtime_error Si el fichero no se puede escribir
+ */
+void Laberinto::GuardarInstantanea(const std::string& outputfile) const {
+  std::ofstream fichero{outputfile, std::ios::binary};
+  if (!fichero.is_open()) {
+    throw std::runtime_error("No se pudo crear el fichero: " + outputfile);
+  }
+  CabeceraInstantaneaLaberinto cabecera{};
+  std::memcpy(cabecera.magia, kMagiaLaberinto, sizeof(kMagiaLaberinto));
+  cabecera.version = kVersionInstantaneaLaberinto;
+  cabecera.orden_bytes = kOrdenBytes;
+  cabecera.filas = filas_;
+  cabecera.columnas = columnas_;
+  cabecera.start_fila = coordenadas_start_.first;
+  cabecera.start_columna = coordenadas_start_.second;
+  cabecera.exit_fila = coordenadas_exit_.first;
+  cabecera.exit_columna = coordenadas_exit_.second;
+  fichero.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+  fichero.write(reinterpret_cast<const char*>(matriz_casillas_.data()), matriz_casillas_.size_bytes());
+  if (!fichero) {
+    throw std::runtime_error("Error al escribir el fichero: " + outputfile);
+  }
+}
+
+/**
+ * @brief Carga el laberinto desde una instantánea binaria proyectada en memoria
+ * @param fichero Proyección copy-on-write del fichero (el laberinto pasa a ser su dueño)
+ * @throws std::runtime_error Si la cabecera, el tamaño o las casillas no son válidos
+ *         (el laberinto conserva entonces el contenido anterior)
+ * 
+ * Las casillas apuntan directamente a la proyección. Como es copy-on-write,
+ * el dinamismo puede modificar casillas sin tocar el fichero y solo se copian
+ * las páginas que realmente cambian. Las máscaras se calculan después de
+ * validar las casillas.
+ */
+void Laberinto::CargarInstantanea(std::unique_ptr<FicheroMapeado> fichero) {
+  CabeceraInstantaneaLaberinto cabecera{};
+  if (fichero->size() < sizeof(cabecera)) {
+    throw std::runtime_error("Instantánea de laberinto truncada: falta la cabecera");
+  }
+  std::memcpy(&cabecera, fichero->data(), sizeof(cabecera));
+  if (cabecera.version != kVersionInstantaneaLaberinto) {
+    throw std::runtime_error("Versión de instantánea de laberinto no soportada: " + std::to_string(cabecera.version));
+  }
+  if (cabecera.orden_bytes != kOrdenBytes) {
+    throw std::runtime_error("Instantánea de laberinto creada con otro orden de bytes");
+  }
+  // Cada dimensión cabe en el fichero, así que sumarle 2 no desborda, y el
+  // producto se acota dividiendo en lugar de multiplicar
+  const uint64_t bytes_cuerpo = fichero->size() - sizeof(cabecera);
+  if (cabecera.filas > bytes_cuerpo || cabecera.columnas > bytes_cuerpo ||
+      cabecera.filas + 2 > bytes_cuerpo / (cabecera.columnas + 2)) {
+    throw std::runtime_error("Instantánea de laberinto con tamaño o coordenadas incoherentes");
+  }
+  const size_t casillas_con_borde = (cabecera.filas + 2) * (cabecera.columnas + 2);
+  if (bytes_cuerpo != casillas_con_borde ||
+      cabecera.start_fila >= cabecera.filas || cabecera.start_columna >= cabecera.columnas ||
+      cabecera.exit_fila >= cabecera.filas || cabecera.exit_columna >= cabecera.columnas) {
+    throw std::runtime_error("Instantánea de laberinto con tamaño o coordenadas incoherentes");
+  }
+  char* datos = fichero->data_escribible() + sizeof(cabecera);
+  const std::span<Casilla> casillas{reinterpret_cast<Casilla*>(datos), casillas_con_borde};
+  ValidarCasillas(casillas, cabecera.filas, cabecera.columnas);
+  // Todo es válido: se sustituye el laberinto anterior
+  filas_ = cabecera.filas;
+  columnas_ = cabecera.columnas;
+  coordenadas_start_ = {cabecera.start_fila, cabecera.start_columna};
+  coordenadas_exit_ = {cabecera.exit_fila, cabecera.exit_columna};
+  matriz_casillas_ = casillas;
+  almacen_casillas_.clear();
+  instantanea_ = std::move(fichero);
+  InicializarDesplazamientos();
+  IndexarCasillasCargadas();
+}
+
 //============================================================================
 // OPERADORES SOBRECARGADOS
 //============================================================================
@@ -510,8 +863,9 @@ std::ostream& operator<<(std::ostream& os, const Laberinto& laberinto) {
   os << "Coordenadas entrada: " << laberinto.coordenadas_start_.first << "," << laberinto.coordenadas_start_.second << std::endl;
   os << "Coordenadas salida: " << laberinto.coordenadas_exit_.first << "," << laberinto.coordenadas_exit_.second << std::endl;
   for (size_t i{0}; i < laberinto.filas_; ++i) {
+    const std::span<const Casilla> fila = laberinto.Fila(i);
     for (size_t j{0}; j < laberinto.columnas_; ++j) {
-      os << laberinto.matriz_casillas_[i][j].ImprimirCasilla();
+      os << fila[j].ImprimirCasilla();
       if (j + 1 < laberinto.columnas_) os << ' ';
     }
     os << std::endl;
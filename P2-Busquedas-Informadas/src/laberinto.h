@@ -25,8 +25,58 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <random>
+#include <memory>
+#include <limits>
 #include "casilla.h"
+#include "fichero_mapeado.h"
+
+/**
+ * @struct Vecino
+ * @brief Casilla vecina alcanzable junto con el coste del movimiento
+ */
+struct Vecino {
+  std::pair<size_t, size_t> posicion{};
+  size_t indice{};   // fila * columnas + columna
+  double coste{};    // 5.0 ortogonal, 7.0 diagonal
+};
+
+/**
+ * @struct Vecindario
+ * @brief Vecinos de una casilla en un array fijo de 8 (sin memoria dinámica)
+ */
+struct Vecindario {
+  std::array<Vecino, 8> vecinos{};
+  size_t cantidad{};
+  // Recorrido con range-for
+  const Vecino* begin() const noexcept { return vecinos.data(); }
+  const Vecino* end() const noexcept { return vecinos.data() + cantidad; }
+  bool empty() const noexcept { return cantidad == 0; }
+  size_t size() const noexcept { return cantidad; }
+};
+
+/**
+ * @struct ParametrosDinamismo
+ * @brief Probabilidades de mutación y límite de obstáculos de ActualizarDinamismo
+ */
+struct ParametrosDinamismo {
+  double pin{0.5};         // Probabilidad de que una casilla libre pase a obstáculo
+  double pout{0.5};        // Probabilidad de que un obstáculo pase a casilla libre
+  double max_ratio{0.25};  // Fracción máxima de casillas bloqueadas tras cada paso
+};
+
+/**
+ * @struct CambioCasilla
+ * @brief Casilla cuyo tipo cambió en el último paso de dinamismo y su tipo anterior
+ */
+struct CambioCasilla {
+  std::pair<size_t, size_t> posicion{};
+  Tipo_Casilla anterior{};
+};
 
 /**
  * @class Laberinto
@@ -36,7 +86,15 @@
  * - Los obstáculos pueden aparecer/desaparecer dinámicamente
  * - Existe un punto de entrada (Start) y uno de salida (Exit)
  * - Se puede calcular la heurística y coste de movimiento entre casillas
- * - Se garantiza un máximo del 25% de casillas bloqueadas
+ * - Se garantiza un máximo de casillas bloqueadas (25% por defecto)
+ * 
+ * El dinamismo usa un generador propio que vive tanto como el laberinto. Con la
+ * misma semilla y los mismos parámetros la secuencia de cambios es reproducible.
+ * Cada paso cuesta O(casillas que cambian), no O(filas x columnas): las casillas
+ * que mutan se muestrean saltando con una distribución geométrica y se mantiene
+ * un índice de obstáculos. Los cambios del último paso quedan en cambios_dinamismo()
+ * y cada paso incrementa version(), de modo que las estructuras derivadas (por
+ * ejemplo TablaSaltos) saben si pueden actualizarse solo con esos cambios.
  * 
  * @note El laberinto utiliza 8-conectividad para el movimiento
  * @see Casilla
@@ -48,41 +106,97 @@ class Laberinto {
   Laberinto(const std::string& laberinto) { ProcesarLaberinto(laberinto); }
   // Metodos de utilidad
   void ProcesarLaberinto(const std::string&);
+  void GuardarInstantanea(const std::string&) const;
   void CambiarEntradaYSalida(const std::pair<size_t, size_t>&, const std::pair<size_t, size_t>& );
   void ActualizarDinamismo();
   // Metodos de utilidad para A*
-  std::vector<std::pair<size_t, size_t>> GetVecinosCasilla(const size_t, const size_t) const;
+  Vecindario GetVecinosCasilla(const size_t, const size_t) const;
   double MoveCost(const size_t, const size_t, const size_t, const size_t) const;
   double HeuristicaManhattan(const size_t, const size_t) const;
   double HeuristicaOctile(const size_t, const size_t) const;
-  double CalcularCosteCamino(const std::vector<std::pair<size_t, size_t>>& camino) const;
+  double CalcularCosteCamino(std::span<const std::pair<size_t, size_t>> camino) const;
   // Google Style getters
   int filas() const noexcept { return filas_; }
   int columnas() const noexcept {return columnas_; }
-  const Casilla& getCasilla(const size_t fila, const size_t columna) const { return matriz_casillas_[fila][columna]; }
+  const Casilla& getCasilla(const size_t fila, const size_t columna) const { return CasillaEn(fila, columna); }
+  // Admite fila -1 o filas() y columna -1 o columnas(): el borde cuenta como obstáculo
+  bool EsTransitable(const long fila, const long columna) const noexcept {
+    return matriz_casillas_[static_cast<size_t>(fila + 1) * (columnas_ + 2) + static_cast<size_t>(columna + 1)].tipo() !=
+           Tipo_Casilla::Obstaculo;
+  }
+  std::span<const Casilla> Fila(const size_t fila) const { 
+    return {matriz_casillas_.data() + (fila + 1) * (columnas_ + 2) + 1, columnas_}; 
+  }
   std::pair<size_t, size_t> coordenadas_start() const noexcept {   return coordenadas_start_; }
   std::pair<size_t, size_t> coordenadas_exit() const noexcept {  return coordenadas_exit_; }
+  uint32_t semilla() const noexcept { return semilla_; }
+  const ParametrosDinamismo& parametros_dinamismo() const noexcept { return parametros_dinamismo_; }
+  const std::vector<CambioCasilla>& cambios_dinamismo() const noexcept { return cambios_; }
+  uint64_t version() const noexcept { return version_; }
+  size_t numero_obstaculos() const noexcept { return numero_obstaculos_; }
+  // Setters
+  void set_semilla(uint32_t semilla) { semilla_ = semilla; generador_.seed(semilla); }
+  void set_parametros_dinamismo(const ParametrosDinamismo&);
   // Sobrecarga operadores
   friend std::ostream& operator<<(std::ostream&, const Laberinto&);
 
  private:
   size_t filas_{};
   size_t columnas_{};
-  std::vector<std::vector<Casilla>> matriz_casillas_{};
+  // Fila mayor con un borde de obstáculos: casilla (i, j) en (i + 1) * (columnas_ + 2) + j + 1
+  std::span<Casilla> matriz_casillas_{};
+  std::array<std::ptrdiff_t, 8> desplazamientos_{};
+  // Bit k a 1 si el movimiento en la dirección k es legal desde la casilla (mismo índice con borde)
+  std::span<uint8_t> mascaras_movimiento_{};
+  // Memoria de las vistas anteriores: las casillas están en almacen_casillas_ (texto) o en la
+  // instantánea proyectada; las máscaras siempre en almacen_mascaras_
+  std::vector<Casilla> almacen_casillas_{};
+  std::vector<uint8_t> almacen_mascaras_{};
+  std::unique_ptr<FicheroMapeado> instantanea_{};
   std::pair<size_t, size_t> coordenadas_start_{};
   std::pair<size_t, size_t> coordenadas_exit_{};
+  // Estado del dinamismo
+  ParametrosDinamismo parametros_dinamismo_{};
+  uint32_t semilla_{std::random_device{}()};
+  std::mt19937 generador_{semilla_};
+  // Índice de obstáculos: obstaculos_ guarda el índice con borde de cada obstáculo interior
+  // y posicion_obstaculo_[indice_con_borde] su posición en obstaculos_ (kNoEsObstaculo si no lo es).
+  // Solo lo usa el dinamismo, así que se construye la primera vez que se necesita (vacío hasta entonces)
+  static constexpr uint32_t kNoEsObstaculo = std::numeric_limits<uint32_t>::max();
+  std::vector<size_t> obstaculos_{};
+  std::vector<uint32_t> posicion_obstaculo_{};
+  size_t numero_obstaculos_{};
+  // Casillas que cambiaron en el último ActualizarDinamismo o CambiarEntradaYSalida (cada una
+  // aparece una sola vez). Describen el paso de version_ - 1 a version_; cargar salta dos versiones.
+  std::vector<CambioCasilla> cambios_{};
+  uint64_t version_{};
 
   // Metodo Auxiliares privados
+  size_t IndiceConBorde(size_t fila, size_t columna) const noexcept { return (fila + 1) * (columnas_ + 2) + columna + 1; }
+  const Casilla& CasillaEn(size_t fila, size_t columna) const { return matriz_casillas_[IndiceConBorde(fila, columna)]; }
+  void FijarTipo(size_t fila, size_t columna, const Tipo_Casilla tipo);
+  // Metodos auxiliares privados para la máscara de movimientos
+  uint8_t CalcularMascara(size_t indice_con_borde) const noexcept;
+  void RecalcularMascarasAlrededor(size_t fila, size_t columna);
+  void InicializarDesplazamientos();
+  // Metodos auxiliares privados para instantáneas binarias
+  static bool EsInstantanea(const FicheroMapeado&);
+  void CargarInstantanea(std::unique_ptr<FicheroMapeado>);
+  static void ValidarCasillas(std::span<const Casilla>, size_t, size_t);
   bool EsCoordenadaValida(size_t fila, size_t columna) const noexcept;
   bool EsSalidaValida(size_t fila, size_t columna) const noexcept; 
   bool EsEntradaValida(size_t fila, size_t columna) const noexcept; 
   bool EsBorde(size_t, size_t) const noexcept;
   // Metodos Auxiliares privados para dinamico
-  void MutarCeldas(const double, const double, std::mt19937&);
-  void EnforceMaxBloqueo(const double, std::mt19937&);
-  std::vector<std::pair<size_t, size_t>> ObtenerCasillasBloqueadas() const;
+  std::vector<size_t> MutarCeldas(const double, const double, std::mt19937&);
+  void EnforceMaxBloqueo(const double, std::mt19937&, std::vector<size_t>&);
+  void IndexarCasillasCargadas();
+  void AsegurarIndiceObstaculos();
+  std::pair<size_t, size_t> CoordenadasDeIndice(size_t indice_con_borde) const noexcept {
+    return {indice_con_borde / (columnas_ + 2) - 1, indice_con_borde % (columnas_ + 2) - 1};
+  }
   size_t ContarPorcentajeBloqueadas() const noexcept;
-  size_t ContarObstaculos() const noexcept;
+  size_t ContarObstaculos() const noexcept { return numero_obstaculos_; }
   // Métodos auxiliares para movimiento y vecinos
   bool EsMovimientoValido(size_t fila_actual, size_t col_actual, 
                          size_t fila_vecina, size_t col_vecina) const;
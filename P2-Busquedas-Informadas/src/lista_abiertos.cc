@@ -0,0 +1,185 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Implementación de los métodos de la clase ListaAbiertos
+  * @version 1.0
+  */
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include "lista_abiertos.h"
+
+//============================================================================
+// MÉTODOS DE UTILIDAD
+//============================================================================
+
+/**
+ * @brief Prepara la lista para un laberinto de las dimensiones dadas
+ * @param filas Número de filas del laberinto
+ * @param columnas Número de columnas del laberinto
+ * @note Si las dimensiones no cambian solo se vacía la lista, sin reservar memoria
+ */
+void ListaAbiertos::Reiniciar(const size_t filas, const size_t columnas) {
+  if (columnas_ == columnas && posicion_en_heap_.size() == filas * columnas) {
+    clear();
+    return;
+  }
+  columnas_ = columnas;
+  heap_.clear();
+  posicion_en_heap_.assign(filas * columnas, kNoEsta);
+  siguiente_orden_ = 0;
+}
+
+/**
+ * @brief Vacía la lista tocando solo las casillas que contiene
+ */
+void ListaAbiertos::clear() {
+  for (const auto& entrada : heap_) {
+    posicion_en_heap_[Indice(entrada.datos.posicion)] = kNoEsta;
+  }
+  heap_.clear();
+  siguiente_orden_ = 0;
+}
+
+/**
+ * @brief Inserta un nodo nuevo en la lista
+ * @param n Nodo a insertar (su casilla no debe estar ya en la lista)
+ */
+void ListaAbiertos::Insertar(const nodo& n) {
+  heap_.push_back({n, siguiente_orden_++});
+  posicion_en_heap_[Indice(n.posicion)] = heap_.size() - 1;
+  Subir(heap_.size() - 1);
+}
+
+/**
+ * @brief Extrae el nodo de menor f(n)
+ * @return Nodo extraído
+ * @throws std::out_of_range Si la lista está vacía
+ * @note En caso de empate se devuelve el que lleva más tiempo en la lista
+ */
+nodo ListaAbiertos::ExtraerMejor() {
+  if (heap_.empty()) {
+    throw std::out_of_range("Lista de abiertos vacía");
+  }
+  nodo mejor = heap_.front().datos;
+  Intercambiar(0, heap_.size() - 1);
+  heap_.pop_back();
+  posicion_en_heap_[Indice(mejor.posicion)] = kNoEsta;
+  if (!heap_.empty()) {
+    Bajar(0);
+  }
+  return mejor;
+}
+
+/**
+ * @brief Comprueba si una casilla está en la lista de abiertos
+ * @param pos Coordenadas (fila, columna) de la casilla
+ * @return true si la casilla está en A
+ */
+bool ListaAbiertos::Contiene(const std::pair<size_t, size_t>& pos) const {
+  return posicion_en_heap_[Indice(pos)] != kNoEsta;
+}
+
+/**
+ * @brief Obtiene el nodo abierto asociado a una casilla
+ * @param pos Coordenadas (fila, columna) de la casilla (debe estar en A)
+ * @return Referencia al nodo almacenado
+ */
+const nodo& ListaAbiertos::Obtener(const std::pair<size_t, size_t>& pos) const {
+  return heap_[posicion_en_heap_[Indice(pos)]].datos;
+}
+
+/**
+ * @brief Actualiza g(n), f(n) y el padre de un nodo abierto (decrease-key)
+ * @param pos Coordenadas de la casilla (debe estar en A)
+ * @param g_cost Nuevo coste acumulado, menor que el actual
+ * @param padre Nuevo padre del nodo
+ * @note El nodo conserva su orden de inserción para el desempate
+ */
+void ListaAbiertos::MejorarCoste(const std::pair<size_t, size_t>& pos, const double g_cost,
+                                 const std::pair<int, int>& padre) {
+  const size_t i = posicion_en_heap_[Indice(pos)];
+  nodo& n = heap_[i].datos;
+  n.g_cost = g_cost;
+  n.f_cost = g_cost + n.h_cost;
+  n.padre = padre;
+  Subir(i);
+}
+
+/**
+ * @brief Devuelve los nodos abiertos en el orden en que fueron generados
+ * @return Vector con los nodos de A ordenados por inserción
+ * @note Solo para informes; mantiene la salida del antiguo std::vector
+ */
+std::vector<nodo> ListaAbiertos::EnOrdenDeInsercion() const {
+  std::vector<Entrada> entradas{heap_};
+  std::sort(entradas.begin(), entradas.end(),
+            [](const Entrada& a, const Entrada& b) { return a.orden < b.orden; });
+  std::vector<nodo> nodos;
+  nodos.reserve(entradas.size());
+  for (const auto& entrada : entradas) {
+    nodos.push_back(entrada.datos);
+  }
+  return nodos;
+}
+
+//============================================================================
+// MÉTODOS PRIVADOS DEL MONTÍCULO
+//============================================================================
+
+/**
+ * @brief Orden del montículo: menor f(n) y, a igualdad, menor orden de inserción
+ */
+bool ListaAbiertos::Precede(const Entrada& a, const Entrada& b) const noexcept {
+  if (a.datos.f_cost != b.datos.f_cost) {
+    return a.datos.f_cost < b.datos.f_cost;
+  }
+  return a.orden < b.orden;
+}
+
+/**
+ * @brief Intercambia dos entradas del montículo manteniendo el índice
+ */
+void ListaAbiertos::Intercambiar(const size_t i, const size_t j) {
+  std::swap(heap_[i], heap_[j]);
+  posicion_en_heap_[Indice(heap_[i].datos.posicion)] = i;
+  posicion_en_heap_[Indice(heap_[j].datos.posicion)] = j;
+}
+
+/**
+ * @brief Hace flotar una entrada hacia la raíz
+ */
+void ListaAbiertos::Subir(size_t i) {
+  while (i > 0) {
+    const size_t padre = (i - 1) / 2;
+    if (!Precede(heap_[i], heap_[padre])) break;
+    Intercambiar(i, padre);
+    i = padre;
+  }
+}
+
+/**
+ * @brief Hunde una entrada hacia las hojas
+ */
+void ListaAbiertos::Bajar(size_t i) {
+  const size_t n = heap_.size();
+  while (true) {
+    size_t menor = i;
+    const size_t izq = 2 * i + 1;
+    const size_t der = 2 * i + 2;
+    if (izq < n && Precede(heap_[izq], heap_[menor])) menor = izq;
+    if (der < n && Precede(heap_[der], heap_[menor])) menor = der;
+    if (menor == i) break;
+    Intercambiar(i, menor);
+    i = menor;
+  }
+}
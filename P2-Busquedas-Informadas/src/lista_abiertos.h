@@ -0,0 +1,71 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Definición de la clase ListaAbiertos (lista A del algoritmo A*)
+  * @version 1.0
+  */
+
+#ifndef LISTA_ABIERTOS_H
+#define LISTA_ABIERTOS_H
+
+#include <vector>
+#include <utility>
+#include <limits>
+#include "nodo.h"
+
+/**
+ * @class ListaAbiertos
+ * @brief Cola de prioridad indexada para la lista de nodos abiertos de A*
+ *
+ * Montículo binario de mínimos ordenado por f(n) con un índice
+ * casilla -> posición en el montículo, de modo que:
+ * - Extraer el mejor nodo cuesta O(log n)
+ * - Comprobar si una casilla está en A cuesta O(1)
+ * - Mejorar el coste de un nodo (decrease-key) cuesta O(log n)
+ *
+ * Los empates en f(n) se resuelven por orden de inserción, igual que la
+ * antigua búsqueda lineal sobre std::vector, para que los contadores de
+ * nodos generados e inspeccionados no cambien.
+ */
+class ListaAbiertos {
+ public:
+  ListaAbiertos() = default;
+  // Metodos de utilidad
+  void Reiniciar(const size_t filas, const size_t columnas);
+  void clear();
+  void Insertar(const nodo&);
+  nodo ExtraerMejor();
+  bool Contiene(const std::pair<size_t, size_t>&) const;
+  const nodo& Obtener(const std::pair<size_t, size_t>&) const;
+  void MejorarCoste(const std::pair<size_t, size_t>&, const double, const std::pair<int, int>&);
+  std::vector<nodo> EnOrdenDeInsercion() const;
+  // Google style getters
+  bool empty() const noexcept { return heap_.empty(); }
+  size_t size() const noexcept { return heap_.size(); }
+
+ private:
+  struct Entrada {
+    nodo datos{};
+    size_t orden{};
+  };
+  static constexpr size_t kNoEsta = std::numeric_limits<size_t>::max();
+  size_t columnas_{};
+  size_t siguiente_orden_{};
+  std::vector<Entrada> heap_{};
+  std::vector<size_t> posicion_en_heap_{};
+  // Metodos auxiliares del montículo
+  size_t Indice(const std::pair<size_t, size_t>& pos) const noexcept { return pos.first * columnas_ + pos.second; }
+  bool Precede(const Entrada&, const Entrada&) const noexcept;
+  void Intercambiar(const size_t, const size_t);
+  void Subir(size_t);
+  void Bajar(size_t);
+};
+
+#endif
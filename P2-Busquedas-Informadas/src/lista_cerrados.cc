@@ -0,0 +1,85 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Implementación de los métodos de la clase ListaCerrados
+  * @version 1.0
+  */
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include "lista_cerrados.h"
+
+/**
+ * @brief Prepara la lista para un laberinto de las dimensiones dadas
+ * @param filas Número de filas del laberinto
+ * @param columnas Número de columnas del laberinto
+ * @note Si las dimensiones no cambian solo se avanza la generación
+ */
+void ListaCerrados::Reiniciar(const size_t filas, const size_t columnas) {
+  if (columnas_ == columnas && marca_.size() == filas * columnas) {
+    clear();
+    return;
+  }
+  columnas_ = columnas;
+  generacion_ = 1;
+  marca_.assign(filas * columnas, 0);
+  cerradas_.clear();
+}
+
+/**
+ * @brief Vacía la lista en O(1) avanzando la generación
+ * @note Solo se recorre el array de marcas cuando el contador da la vuelta
+ */
+void ListaCerrados::clear() {
+  cerradas_.clear();
+  if (generacion_ == std::numeric_limits<uint32_t>::max()) {
+    std::fill(marca_.begin(), marca_.end(), 0);
+    generacion_ = 0;
+  }
+  ++generacion_;
+}
+
+/**
+ * @brief Marca una casilla como cerrada
+ * @param pos Coordenadas (fila, columna) de la casilla
+ */
+void ListaCerrados::Insertar(const std::pair<size_t, size_t>& pos) {
+  uint32_t& marca = marca_[Indice(pos)];
+  if (marca == generacion_) return;
+  marca = generacion_;
+  cerradas_.push_back(Indice(pos));
+}
+
+/**
+ * @brief Comprueba si una casilla está cerrada en la generación actual
+ * @param pos Coordenadas (fila, columna) de la casilla
+ * @return true si la casilla está en C
+ */
+bool ListaCerrados::Contiene(const std::pair<size_t, size_t>& pos) const {
+  return marca_[Indice(pos)] == generacion_;
+}
+
+/**
+ * @brief Devuelve las casillas cerradas ordenadas por (fila, columna)
+ * @return Vector ordenado con las coordenadas de las casillas de C
+ * @note Solo para informes; reproduce el orden del antiguo std::set
+ */
+std::vector<std::pair<size_t, size_t>> ListaCerrados::EnOrden() const {
+  std::vector<size_t> indices{cerradas_};
+  std::sort(indices.begin(), indices.end());
+  std::vector<std::pair<size_t, size_t>> casillas;
+  casillas.reserve(indices.size());
+  for (const size_t indice : indices) {
+    casillas.emplace_back(indice / columnas_, indice % columnas_);
+  }
+  return casillas;
+}
@@ -0,0 +1,55 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Definición de la clase ListaCerrados (lista C del algoritmo A*)
+  * @version 1.0
+  */
+
+#ifndef LISTA_CERRADOS_H
+#define LISTA_CERRADOS_H
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+/**
+ * @class ListaCerrados
+ * @brief Conjunto denso de casillas cerradas indexado por fila * columnas + col
+ *
+ * Cada casilla guarda la generación en la que se cerró por última vez, de
+ * modo que vaciar la lista entre replanificaciones es O(1): basta con
+ * avanzar la generación. Insertar y consultar son un acceso a un array.
+ *
+ * Se guarda además la lista de casillas insertadas para poder recorrerlas
+ * en el mismo orden (fila, columna) que el antiguo std::set en los informes.
+ */
+class ListaCerrados {
+ public:
+  ListaCerrados() = default;
+  // Metodos de utilidad
+  void Reiniciar(const size_t filas, const size_t columnas);
+  void clear();
+  void Insertar(const std::pair<size_t, size_t>&);
+  bool Contiene(const std::pair<size_t, size_t>&) const;
+  std::vector<std::pair<size_t, size_t>> EnOrden() const;
+  // Google style getters
+  bool empty() const noexcept { return cerradas_.empty(); }
+  size_t size() const noexcept { return cerradas_.size(); }
+
+ private:
+  size_t columnas_{};
+  uint32_t generacion_{1};
+  std::vector<uint32_t> marca_{};
+  std::vector<size_t> cerradas_{};
+  // Metodos auxiliares
+  size_t Indice(const std::pair<size_t, size_t>& pos) const noexcept { return pos.first * columnas_ + pos.second; }
+};
+
+#endif
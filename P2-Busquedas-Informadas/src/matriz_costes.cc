@@ -0,0 +1,55 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Implementación de los métodos de la clase MatrizCostes
+  * @version 1.0
+  */
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include "matriz_costes.h"
+
+/**
+ * @brief Prepara la matriz para un laberinto de las dimensiones dadas
+ * @param filas Número de filas del laberinto
+ * @param columnas Número de columnas del laberinto
+ * @note Si las dimensiones no cambian solo se avanza la generación
+ */
+void MatrizCostes::Reiniciar(const size_t filas, const size_t columnas) {
+  if (columnas_ == columnas && entradas_.size() == filas * columnas) {
+    clear();
+    return;
+  }
+  columnas_ = columnas;
+  generacion_ = 1;
+  entradas_.assign(filas * columnas, Entrada{});
+}
+
+/**
+ * @brief Vacía la matriz en O(1) avanzando la generación
+ * @note Solo se recorre el array cuando el contador da la vuelta
+ */
+void MatrizCostes::clear() {
+  if (generacion_ == std::numeric_limits<uint32_t>::max()) {
+    std::fill(entradas_.begin(), entradas_.end(), Entrada{});
+    generacion_ = 0;
+  }
+  ++generacion_;
+}
+
+/**
+ * @brief Guarda g(n) y el padre de un nodo en su casilla
+ * @param n Nodo cuya posición indica la casilla
+ */
+void MatrizCostes::Fijar(const nodo& n) {
+  entradas_[Indice(n.posicion)] = {n.g_cost, n.padre, generacion_};
+}
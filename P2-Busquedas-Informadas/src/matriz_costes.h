@@ -0,0 +1,63 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Definición de la clase MatrizCostes (g(n) y padre de cada casilla alcanzada)
+  * @version 1.0
+  */
+
+#ifndef MATRIZ_COSTES_H
+#define MATRIZ_COSTES_H
+
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstdint>
+#include "nodo.h"
+
+/**
+ * @class MatrizCostes
+ * @brief Coste g(n) y padre de cada casilla en un array plano indexado por fila * columnas + col
+ *
+ * Igual que ListaCerrados, cada casilla guarda la generación en la que se
+ * escribió por última vez: vaciar la matriz entre búsquedas es O(1) y una
+ * replanificación solo toca las casillas que alcanza. Una casilla no escrita
+ * en la generación actual tiene g infinito y padre (-1, -1).
+ */
+class MatrizCostes {
+ public:
+  MatrizCostes() = default;
+  // Metodos de utilidad
+  void Reiniciar(const size_t filas, const size_t columnas);
+  void clear();
+  void Fijar(const nodo&);
+  // Google style getters
+  double g_cost(const std::pair<size_t, size_t>& pos) const noexcept {
+    const Entrada& entrada = entradas_[Indice(pos)];
+    return entrada.generacion == generacion_ ? entrada.g_cost : std::numeric_limits<double>::infinity();
+  }
+  std::pair<int, int> padre(const std::pair<size_t, size_t>& pos) const noexcept {
+    const Entrada& entrada = entradas_[Indice(pos)];
+    return entrada.generacion == generacion_ ? entrada.padre : std::pair<int, int>{-1, -1};
+  }
+
+ private:
+  struct Entrada {
+    double g_cost{};
+    std::pair<int, int> padre{-1, -1};
+    uint32_t generacion{};
+  };
+  size_t columnas_{};
+  uint32_t generacion_{1};
+  std::vector<Entrada> entradas_{};
+  // Metodos auxiliares
+  size_t Indice(const std::pair<size_t, size_t>& pos) const noexcept { return pos.first * columnas_ + pos.second; }
+};
+
+#endif
@@ -0,0 +1,59 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Definición del nodo del árbol de búsqueda A*
+  * @version 1.0
+  */
+
+#ifndef NODO_H
+#define NODO_H
+
+#include <iostream>
+#include <utility>
+
+/**
+ * @struct nodo
+ * @brief Representa un nodo en el árbol de búsqueda A*
+ * 
+ * Estructura que almacena toda la información necesaria para un nodo
+ * durante la ejecución del algoritmo A*:
+ * - Posición en el laberinto
+ * - Costes g(n), h(n) y f(n)
+ * - Referencia al nodo padre para reconstrucción del camino
+ * 
+ * La función de evaluación es: f(n) = g(n) + h(n)
+ * donde:
+ * - g(n) = coste acumulado desde el inicio hasta n
+ * - h(n) = estimación heurística del coste de n hasta la meta
+ * - f(n) = estimación del coste total del camino pasando por n
+ */
+typedef struct nodo {
+  std::pair<size_t, size_t> posicion{};
+  double g_cost{}, h_cost{}, f_cost{};
+  std::pair<int, int> padre{-1, -1};
+  // Metodos
+  nodo() = default;
+  nodo(std::pair<size_t, size_t> pos, double g, double h, std::pair<int, int> p) 
+                : posicion{pos}, g_cost{g}, h_cost{h}, f_cost{g + h}, padre(p) {}
+  // Operador < necesario para std::set
+  bool operator<(const nodo& other) const {
+    if (posicion.first != other.posicion.first) {
+      return posicion.first < other.posicion.first;
+    }
+    return posicion.second < other.posicion.second;
+  }
+  friend std::ostream& operator<<(std::ostream& os, const nodo& n) {
+    os << "pos=(" << n.posicion.first << "," << n.posicion.second << ") "
+       << "g=" << n.g_cost << " h=" << n.h_cost << " f=" << n.f_cost << "\n";
+    return os;
+  }
+} nodo;
+
+#endif
@@ -0,0 +1,157 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Implementación de la clase TablaSaltos
+  * @version 1.0
+  */
+
+#include "tabla_saltos.h"
+#include <algorithm>
+
+/**
+ * @brief Deja la tabla al día con el laberinto
+ * @param laberinto Laberinto sobre el que se busca
+ *
+ * Si la tabla corresponde a la versión anterior del mismo laberinto solo se
+ * recalculan las filas y columnas vecinas de las casillas de cambios_dinamismo();
+ * si ya está al día no se hace nada y en otro caso se reconstruye entera.
+ */
+void TablaSaltos::Sincronizar(const Laberinto& laberinto) {
+  const bool misma_forma = laberinto_ == &laberinto && !saltos_.empty() &&
+                           filas_ == static_cast<size_t>(laberinto.filas()) &&
+                           columnas_ == static_cast<size_t>(laberinto.columnas());
+  if (misma_forma && laberinto.version() == version_) {
+    return;
+  }
+  if (!misma_forma || laberinto.version() != version_ + 1) {
+    Reconstruir(laberinto);
+    return;
+  }
+  std::vector<bool> fila_pendiente(filas_, false);
+  std::vector<bool> columna_pendiente(columnas_, false);
+  for (const auto& cambio : laberinto.cambios_dinamismo()) {
+    const auto [fila, columna] = cambio.posicion;
+    for (size_t f = fila > 0 ? fila - 1 : 0; f <= std::min(fila + 1, filas_ - 1); ++f) {
+      fila_pendiente[f] = true;
+    }
+    for (size_t c = columna > 0 ? columna - 1 : 0; c <= std::min(columna + 1, columnas_ - 1); ++c) {
+      columna_pendiente[c] = true;
+    }
+  }
+  for (size_t f = 0; f < filas_; ++f) {
+    if (fila_pendiente[f]) RecalcularFila(laberinto, f);
+  }
+  for (size_t c = 0; c < columnas_; ++c) {
+    if (columna_pendiente[c]) RecalcularColumna(laberinto, c);
+  }
+  version_ = laberinto.version();
+}
+
+/**
+ * @brief Índice en la tabla de una dirección ortogonal
+ */
+int TablaSaltos::DireccionDe(int diff_fila, int diff_columna) noexcept {
+  if (diff_fila != 0) {
+    return diff_fila < 0 ? kNorte : kSur;
+  }
+  return diff_columna < 0 ? kOeste : kEste;
+}
+
+/**
+ * @brief Comprueba si una casilla alcanzada en línea recta es un punto de salto
+ * @param laberinto Laberinto sobre el que se busca
+ * @param fila Fila de la casilla
+ * @param columna Columna de la casilla
+ * @param diff_fila Dirección del movimiento en filas (0 si es horizontal)
+ * @param diff_columna Dirección del movimiento en columnas (0 si es vertical)
+ * @return true si tiene algún vecino forzado
+ *
+ * Avanzando en horizontal, la diagonal hacia la fila de arriba (o de abajo) solo
+ * es forzada si la casilla de arriba (o de abajo) es un obstáculo: si no, se llega
+ * igual de barato pasando por ella. En vertical es lo mismo con las columnas.
+ */
+bool TablaSaltos::EsSaltoRectoForzado(const Laberinto& laberinto, long fila, long columna,
+                                      int diff_fila, int diff_columna) noexcept {
+  if (diff_fila == 0) {
+    return (laberinto.EsTransitable(fila + 1, columna + diff_columna) && !laberinto.EsTransitable(fila + 1, columna)) ||
+           (laberinto.EsTransitable(fila - 1, columna + diff_columna) && !laberinto.EsTransitable(fila - 1, columna));
+  }
+  return (laberinto.EsTransitable(fila + diff_fila, columna + 1) && !laberinto.EsTransitable(fila, columna + 1)) ||
+         (laberinto.EsTransitable(fila + diff_fila, columna - 1) && !laberinto.EsTransitable(fila, columna - 1));
+}
+
+//============================================================================
+// MÉTODOS AUXILIARES
+//============================================================================
+
+/**
+ * @brief Calcula la tabla completa
+ */
+void TablaSaltos::Reconstruir(const Laberinto& laberinto) {
+  laberinto_ = &laberinto;
+  filas_ = static_cast<size_t>(laberinto.filas());
+  columnas_ = static_cast<size_t>(laberinto.columnas());
+  saltos_.assign(filas_ * columnas_ * 4, 0);
+  for (size_t f = 0; f < filas_; ++f) {
+    RecalcularFila(laberinto, f);
+  }
+  for (size_t c = 0; c < columnas_; ++c) {
+    RecalcularColumna(laberinto, c);
+  }
+  version_ = laberinto.version();
+}
+
+/**
+ * @brief Recalcula los saltos hacia el oeste y el este de una fila
+ */
+void TablaSaltos::RecalcularFila(const Laberinto& laberinto, size_t fila) {
+  const long f = static_cast<long>(fila);
+  for (size_t c = columnas_; c-- > 0;) {
+    const int32_t siguiente = c + 1 < columnas_ ? Salto(fila, c + 1, kEste) : 0;
+    Salto(fila, c, kEste) = Encadenar(laberinto, f, static_cast<long>(c) + 1, 0, 1, siguiente);
+  }
+  for (size_t c = 0; c < columnas_; ++c) {
+    const int32_t siguiente = c > 0 ? Salto(fila, c - 1, kOeste) : 0;
+    Salto(fila, c, kOeste) = Encadenar(laberinto, f, static_cast<long>(c) - 1, 0, -1, siguiente);
+  }
+}
+
+/**
+ * @brief Recalcula los saltos hacia el norte y el sur de una columna
+ */
+void TablaSaltos::RecalcularColumna(const Laberinto& laberinto, size_t columna) {
+  const long c = static_cast<long>(columna);
+  for (size_t f = filas_; f-- > 0;) {
+    const int32_t siguiente = f + 1 < filas_ ? Salto(f + 1, columna, kSur) : 0;
+    Salto(f, columna, kSur) = Encadenar(laberinto, static_cast<long>(f) + 1, c, 1, 0, siguiente);
+  }
+  for (size_t f = 0; f < filas_; ++f) {
+    const int32_t siguiente = f > 0 ? Salto(f - 1, columna, kNorte) : 0;
+    Salto(f, columna, kNorte) = Encadenar(laberinto, static_cast<long>(f) - 1, c, -1, 0, siguiente);
+  }
+}
+
+/**
+ * @brief Salto de una casilla a partir del de su vecina en la misma dirección
+ * @param fila Fila de la vecina (primer paso del salto)
+ * @param columna Columna de la vecina
+ * @param siguiente Salto ya calculado de la vecina en la misma dirección
+ * @return 0 si la vecina es obstáculo, 1 si es punto de salto y si no el de la vecina alargado en uno
+ */
+int32_t TablaSaltos::Encadenar(const Laberinto& laberinto, long fila, long columna,
+                               int diff_fila, int diff_columna, int32_t siguiente) const noexcept {
+  if (!laberinto.EsTransitable(fila, columna)) {
+    return 0;
+  }
+  if (EsSaltoRectoForzado(laberinto, fila, columna, diff_fila, diff_columna)) {
+    return 1;
+  }
+  return siguiente > 0 ? siguiente + 1 : siguiente - 1;
+}
@@ -0,0 +1,72 @@
+/**
+  * Universidad de La Laguna
+  * Escuela Superior de Ingeniería y Tecnología
+  * Grado en Ingeniería Informática
+  * Inteligencia Artificial 2025-2026
+  * 3º Año de Carrera
+  * Practica 2: Busquedas informadas
+  *
+  * @author Alberto Del Castillo Díaz alu0101627137@ull.edu.es
+  * @date 2025-10-23
+  * @brief Definición de la clase TablaSaltos (saltos rectos precalculados de JPS+)
+  * @version 1.0
+  */
+
+#ifndef TABLA_SALTOS_H
+#define TABLA_SALTOS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "laberinto.h"
+
+/**
+ * @class TablaSaltos
+ * @brief Distancia de salto recto de cada casilla en las 4 direcciones ortogonales (JPS+)
+ *
+ * Para cada casilla y dirección guarda a cuántas casillas está el siguiente
+ * punto de salto recto (valor positivo) o, si antes se llega a un obstáculo,
+ * cuántas casillas se pueden avanzar hasta él con el signo cambiado (0 o
+ * negativo). Así Jump Point Search no recorre casilla a casilla las rectas; la
+ * salida, que depende de cada búsqueda, se comprueba aparte.
+ *
+ * Si un punto de salto es forzado depende de su fila y de las dos vecinas (o de
+ * su columna y las dos vecinas), así que una casilla que cambia solo obliga a
+ * recalcular tres filas y tres columnas. Sincronizar usa Laberinto::version() y
+ * cambios_dinamismo() para hacer eso tras un paso de dinamismo y reconstruye la
+ * tabla completa en cualquier otro caso.
+ */
+class TablaSaltos {
+ public:
+  // Direcciones ortogonales en el orden de la tabla
+  enum Direccion { kNorte = 0, kSur = 1, kOeste = 2, kEste = 3 };
+  TablaSaltos() = default;
+  // laberinto_ solo identifica el laberinto de la tabla, así que copiarla es seguro
+  TablaSaltos(const TablaSaltos&) = default;
+  TablaSaltos& operator=(const TablaSaltos&) = default;
+  // Metodos de utilidad
+  void Sincronizar(const Laberinto&);
+  static int DireccionDe(int diff_fila, int diff_columna) noexcept;
+  static bool EsSaltoRectoForzado(const Laberinto&, long fila, long columna, int diff_fila, int diff_columna) noexcept;
+  // Google style getters
+  int32_t salto(size_t fila, size_t columna, int direccion) const noexcept {
+    return saltos_[(fila * columnas_ + columna) * 4 + static_cast<size_t>(direccion)];
+  }
+
+ private:
+  const Laberinto* laberinto_{};
+  uint64_t version_{};
+  size_t filas_{};
+  size_t columnas_{};
+  std::vector<int32_t> saltos_{};
+  // Metodos auxiliares
+  int32_t& Salto(size_t fila, size_t columna, int direccion) noexcept {
+    return saltos_[(fila * columnas_ + columna) * 4 + static_cast<size_t>(direccion)];
+  }
+  void Reconstruir(const Laberinto&);
+  void RecalcularFila(const Laberinto&, size_t fila);
+  void RecalcularColumna(const Laberinto&, size_t columna);
+  int32_t Encadenar(const Laberinto&, long fila, long columna, int diff_fila, int diff_columna, int32_t siguiente) const noexcept;
+};
+
+#endif